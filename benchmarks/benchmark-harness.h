@@ -0,0 +1,259 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../solutions of equations in one variable/solve-result.h"
+
+// Minimal benchmark harness for the solver suite, without external dependencies.
+//
+// A benchmark is a callable solving one problem and returning its SolveResult. The harness doubles
+// the number of repetitions until one timed run lasts at least `minTime`, then takes the median
+// ns/solve of `samples` such runs, which is robust against the occasional preempted run. The
+// evaluations and iterations per solve come from the result, which is the same on every
+// repetition. A benchmark given the expected root whose result claims convergence elsewhere is
+// recorded with status "WrongRoot" and not timed, so a fast wrong answer never shows as the best.
+// Throughput measurements of the batch engines are recorded separately as scaling points
+// (threads, batch size, ns/root).
+//
+// Results are printed as a table while they are measured and can be written as JSON:
+//
+//     {"context": {...}, "benchmarks": [{"name": "brent/cubic", ...}, ...], "scaling": [...]}
+
+// One solver on one problem.
+struct BenchmarkResult {
+    std::string solver;
+    std::string problem;
+    std::string category;
+    double nsPerSolve = 0;
+    double evaluationsPerSolve = 0;
+    double iterationsPerSolve = 0;
+    double solvesPerSecond = 0;
+    std::size_t repetitions = 0;    // solves per timed run
+    const char* status = "";        // solve_status_name() of the result, or "WrongRoot"
+};
+
+// How far from the expected root a converged result may end, relative to max(|root|, 1).
+inline constexpr double benchmarkRootTolerance = 1e-6;
+
+// One throughput measurement of a batch engine.
+struct ScalingResult {
+    std::string engine;
+    std::size_t threads = 0;
+    std::size_t batch = 0;
+    double nsPerRoot = 0;
+    double rootsPerSecond = 0;
+    double converged = 0;           // fraction of the batch that converged
+};
+
+class BenchmarkHarness {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    std::chrono::duration<double> minTime{0.02};
+    int samples = 5;
+    std::string filter;             // only benchmarks whose name contains it are run
+
+    bool selected(const std::string& name) const {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    /**
+     * @brief Times `solve()`, which solves `problem` with `solver` and returns the SolveResult.
+     *
+     * @param expectedRoot The root of `problem`, if known; a converged result farther than
+     *        rootTolerance·max(|expectedRoot|, 1) from it is recorded as "WrongRoot" without timing.
+     */
+    template <typename Solve>
+    void run(const std::string& solver, const std::string& problem, const std::string& category, Solve&& solve,
+             double expectedRoot = std::numeric_limits<double>::quiet_NaN(),
+             double rootTolerance = benchmarkRootTolerance) {
+        if (!selected(solver + "/" + problem)) {
+            return;
+        }
+        SolveResult first = solve();
+        if (first.converged() && std::isfinite(expectedRoot)
+            && !(std::abs(first.root - expectedRoot) <= rootTolerance * std::max(std::abs(expectedRoot), 1.0))) {
+            BenchmarkResult result;
+            result.solver = solver;
+            result.problem = problem;
+            result.category = category;
+            result.nsPerSolve = result.solvesPerSecond = std::numeric_limits<double>::quiet_NaN();
+            result.evaluationsPerSolve = first.evaluations;
+            result.iterationsPerSolve = first.iterations;
+            result.status = "WrongRoot";
+            std::printf("%-34s %-14s %12s %10.1f %10.1f %14s  %s (root %.17g)\n", (solver + "/" + problem).c_str(),
+                        category.c_str(), "-", result.evaluationsPerSolve, result.iterationsPerSolve, "-",
+                        result.status, first.root);
+            results.push_back(std::move(result));
+            return;
+        }
+
+        std::size_t repetitions = 1;
+        double seconds = time(solve, repetitions);
+        while (seconds < minTime.count() && repetitions < (std::size_t(1) << 30)) {
+            repetitions *= seconds > 0 ? std::clamp<std::size_t>(
+                static_cast<std::size_t>(minTime.count() / seconds * 1.2), 2, 64) : 64;
+            seconds = time(solve, repetitions);
+        }
+        std::vector<double> perSolve(samples);
+        for (double& ns : perSolve) {
+            ns = time(solve, repetitions) * 1e9 / static_cast<double>(repetitions);
+        }
+        std::sort(perSolve.begin(), perSolve.end());
+
+        BenchmarkResult result;
+        result.solver = solver;
+        result.problem = problem;
+        result.category = category;
+        result.nsPerSolve = perSolve[perSolve.size() / 2];
+        result.evaluationsPerSolve = first.evaluations;
+        result.iterationsPerSolve = first.iterations;
+        result.solvesPerSecond = 1e9 / result.nsPerSolve;
+        result.repetitions = repetitions;
+        result.status = solve_status_name(first.status);
+        std::printf("%-34s %-14s %12.1f %10.1f %10.1f %14.0f  %s\n", (solver + "/" + problem).c_str(),
+                    category.c_str(), result.nsPerSolve, result.evaluationsPerSolve, result.iterationsPerSolve,
+                    result.solvesPerSecond, result.status);
+        results.push_back(std::move(result));
+    }
+
+    /**
+     * @brief Times one call of `solveBatch()`, which solves `batch` problems and returns how many converged.
+     */
+    template <typename SolveBatch>
+    void run_scaling(const std::string& engine, std::size_t threads, std::size_t batch, SolveBatch&& solveBatch) {
+        if (!selected(engine)) {
+            return;
+        }
+        std::size_t converged = solveBatch();
+        std::vector<double> seconds(samples);
+        for (double& s : seconds) {
+            auto start = Clock::now();
+            converged = solveBatch();
+            s = std::chrono::duration<double>(Clock::now() - start).count();
+        }
+        std::sort(seconds.begin(), seconds.end());
+
+        ScalingResult result;
+        result.engine = engine;
+        result.threads = threads;
+        result.batch = batch;
+        result.nsPerRoot = seconds[seconds.size() / 2] * 1e9 / static_cast<double>(batch);
+        result.rootsPerSecond = 1e9 / result.nsPerRoot;
+        result.converged = static_cast<double>(converged) / static_cast<double>(batch);
+        std::printf("%-34s threads %3zu batch %8zu %10.2f ns/root %14.0f roots/s\n", engine.c_str(), threads, batch,
+                    result.nsPerRoot, result.rootsPerSecond);
+        scaling.push_back(std::move(result));
+    }
+
+    // `value` laundered through a volatile, so the compiler cannot fold a benchmarked solve with
+    // constant inputs or hoist it out of the timing loop.
+    static double opaque(double value) {
+        volatile double laundered = value;
+        return laundered;
+    }
+
+    static void print_header() {
+        std::printf("%-34s %-14s %12s %10s %10s %14s  %s\n", "solver/problem", "category", "ns/solve", "evals",
+                    "iterations", "solves/s", "status");
+    }
+
+    /**
+     * @brief Writes every result recorded so far as JSON to `path`.
+     *
+     * @return false if the file could not be written.
+     */
+    bool write_json(const std::string& path) const {
+        std::ofstream out(path);
+        out << "{\n  \"context\": {\"hardware_concurrency\": " << std::thread::hardware_concurrency()
+            << ", \"min_time_seconds\": " << number(minTime.count()) << ", \"samples\": " << samples
+            << ", \"compiler\": " << quoted(compiler()) << "},\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const BenchmarkResult& r = results[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": " << quoted(r.solver + "/" + r.problem)
+                << ", \"solver\": " << quoted(r.solver) << ", \"problem\": " << quoted(r.problem)
+                << ", \"category\": " << quoted(r.category) << ", \"ns_per_solve\": " << number(r.nsPerSolve)
+                << ", \"evaluations_per_solve\": " << number(r.evaluationsPerSolve)
+                << ", \"iterations_per_solve\": " << number(r.iterationsPerSolve)
+                << ", \"solves_per_second\": " << number(r.solvesPerSecond)
+                << ", \"repetitions\": " << r.repetitions << ", \"status\": " << quoted(r.status) << "}";
+        }
+        out << "\n  ],\n  \"scaling\": [";
+        for (std::size_t i = 0; i < scaling.size(); i++) {
+            const ScalingResult& s = scaling[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"engine\": " << quoted(s.engine) << ", \"threads\": " << s.threads
+                << ", \"batch\": " << s.batch << ", \"ns_per_root\": " << number(s.nsPerRoot)
+                << ", \"roots_per_second\": " << number(s.rootsPerSecond)
+                << ", \"converged_fraction\": " << number(s.converged) << "}";
+        }
+        out << "\n  ]\n}\n";
+        return static_cast<bool>(out);
+    }
+
+    std::vector<BenchmarkResult> results;
+    std::vector<ScalingResult> scaling;
+
+private:
+    template <typename Solve>
+    static double time(Solve& solve, std::size_t repetitions) {
+        double sink = 0;
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < repetitions; i++) {
+            sink += solve().root;
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        volatileSink = sink;
+        return seconds;
+    }
+
+    static std::string quoted(const std::string& text) {
+        std::string out = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    // JSON has no NaN or infinity
+    static std::string number(double value) {
+        if (!(value == value) || value > 1e300 || value < -1e300) {
+            return "null";
+        }
+        char buffer[32];
+        std::snprintf(buffer, sizeof buffer, "%.6g", value);
+        return buffer;
+    }
+
+    static std::string compiler() {
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    static inline volatile double volatileSink = 0;
+};
+
+#endif //BENCHMARK_HARNESS_H
@@ -0,0 +1,299 @@
+//
+// Created by Hello on 14.10.2026.
+//
+// Benchmark suite of the solvers: every method on every problem of the test corpus (ns/solve,
+// evaluations/solve, solves/s), then the batch engines over batch sizes and thread counts
+// (ns/root, roots/s).
+//
+//     solver-benchmarks [--json results.json] [--filter brent] [--min-time 0.05] [--samples 5] [--max-threads 8]
+//
+// New solvers are added to run_solver_benchmarks(), new batch engines to run_scaling_benchmarks().
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../solutions of equations in one variable/accelerated-solvers.h"
+#include "../solutions of equations in one variable/all-roots-finder.h"
+#include "../solutions of equations in one variable/async-solvers.h"
+#include "../solutions of equations in one variable/auto-solver.h"
+#include "../solutions of equations in one variable/batch-driver.h"
+#include "../solutions of equations in one variable/batch-solvers.h"
+#include "../solutions of equations in one variable/bracketing-solvers.h"
+#include "../solutions of equations in one variable/chebyshev-proxy.h"
+#include "../solutions of equations in one variable/derivative-policies.h"
+#include "../solutions of equations in one variable/dual.h"
+#include "../solutions of equations in one variable/equations-solver.h"
+#include "../solutions of equations in one variable/higher-order-solvers.h"
+#include "../solutions of equations in one variable/inverse-table.h"
+#include "../solutions of equations in one variable/iteration-trace.h"
+#include "../solutions of equations in one variable/ksection-solver.h"
+#include "../solutions of equations in one variable/mixed-precision-solver.h"
+#include "../solutions of equations in one variable/portfolio-solver.h"
+#include "../solutions of equations in one variable/solver-workspace.h"
+#include "../solutions of equations in one variable/stream-solver.h"
+#include "../solutions of equations in one variable/work-stealing-pool.h"
+#include "benchmark-harness.h"
+#include "test-functions.h"
+
+namespace {
+
+constexpr double tolerance = 1e-10;
+constexpr int maxIterations = 1000;
+
+void run_solver_benchmarks(BenchmarkHarness& harness) {
+    BenchmarkHarness::print_header();
+    for_each_test_problem([&]<typename P>(const P& problem) {
+        const char* name = P::name;
+        const char* category = P::category;
+        // Fixed-point form g(x) = x - f(x) / f'(x0), locally contracting near a simple root
+        const double slope = problem(Dual<double>::variable(P::x0)).derivative;
+        auto g = [problem, slope]<typename T>(T x) { return x - problem(x) / slope; };
+        auto a = [] { return BenchmarkHarness::opaque(P::a); };
+        auto b = [] { return BenchmarkHarness::opaque(P::b); };
+        auto x0 = [] { return BenchmarkHarness::opaque(P::x0); };
+        // Every result is checked against the known root
+        double rootTolerance = benchmarkRootTolerance;
+        if constexpr (requires { P::rootTolerance; }) {
+            rootTolerance = P::rootTolerance;
+        }
+        auto run = [&](const char* solver, auto&& solve) {
+            harness.run(solver, name, category, solve, P::root, rootTolerance);
+        };
+
+        run("bisection", [&] { return try_bisection_solver(a(), b(), problem, tolerance, maxIterations); });
+        run("fixed_point", [&] { return try_fixed_point_solver(x0(), g, tolerance, maxIterations); });
+        run("newton_raphson", [&] { return try_newton_raphson_solver(x0(), problem, tolerance, maxIterations); });
+        run("newton_raphson_central", [&] {
+            return try_newton_raphson_solver(x0(), problem, tolerance, maxIterations, CentralDifference{});
+        });
+        run("secant", [&] { return try_secant_solver(a(), b(), problem, tolerance, maxIterations); });
+        run("false_position", [&] { return try_false_position_solver(a(), b(), problem, tolerance, maxIterations); });
+        run("steffensen", [&] { return try_steffensen_solver(x0(), g, tolerance, maxIterations); });
+        run("aitken_fixed_point", [&] {
+            return try_accelerated_fixed_point_solver(x0(), g, AitkenAccelerator{}, tolerance, maxIterations);
+        });
+        run("wynn_fixed_point", [&] {
+            return try_accelerated_fixed_point_solver(x0(), g, WynnEpsilonAccelerator{}, tolerance, maxIterations);
+        });
+        run("brent", [&] { return try_brent_solver(a(), b(), problem, tolerance, maxIterations); });
+        // Cost of recording every iteration into the trace ring
+        run("brent_traced", [&] {
+            return try_brent_solver(a(), b(), problem, tolerance, maxIterations, TraceObserver{});
+        });
+        run("chandrupatla", [&] { return try_chandrupatla_solver(a(), b(), problem, tolerance, maxIterations); });
+        run("itp", [&] { return try_itp_solver(a(), b(), problem, tolerance, maxIterations); });
+        run("safeguarded_newton", [&] { return try_safeguarded_newton_solver(a(), b(), problem, tolerance, maxIterations); });
+        run("halley", [&] { return try_halley_solver(x0(), problem, tolerance, maxIterations); });
+        run("householder", [&] { return try_householder_solver(x0(), problem, tolerance, maxIterations); });
+        run("portfolio", [&] {
+            return portfolio_solver(a(), b(), x0(), problem, {PortfolioMethod::NewtonRaphson, PortfolioMethod::Brent},
+                                    tolerance, maxIterations).result;
+        });
+        run("auto", [&] {
+            return solve(RootProblem{.f = problem, .leftBound = a(), .rightBound = b(), .initialGuess = x0()}).result;
+        });
+        // The same solves in a class of their own, so the method is the one measured cheapest on this problem
+        ProblemClass& learned = problem_class(name);
+        run("auto_learned", [&] {
+            return solve(RootProblem{.f = problem, .leftBound = a(), .rightBound = b(), .initialGuess = x0(),
+                                     .problemClass = &learned}).result;
+        });
+
+        // Engines answering repeated solves from precomputed data; the build is not timed
+        try {
+            ChebyshevProxy proxy(problem, P::a, P::b);
+            run("chebyshev_proxy", [&] { return proxy.try_solve(BenchmarkHarness::opaque(0.0), tolerance, maxIterations); });
+        } catch (const std::exception& error) {
+            std::printf("%-34s skipped: %s\n", (std::string("chebyshev_proxy/") + name).c_str(), error.what());
+        }
+        try {
+            InverseTable table(problem, P::a, P::b);
+            run("inverse_table", [&] { return table.try_solve(BenchmarkHarness::opaque(0.0), tolerance, maxIterations); });
+        } catch (const std::exception& error) {
+            std::printf("%-34s skipped: %s\n", (std::string("inverse_table/") + name).c_str(), error.what());
+        }
+    });
+}
+
+// Thread counts 1, 2, 4, ... up to maxThreads, and maxThreads itself.
+std::vector<std::size_t> thread_counts(std::size_t maxThreads) {
+    std::vector<std::size_t> counts;
+    for (std::size_t t = 1; t < maxThreads; t *= 2) {
+        counts.push_back(t);
+    }
+    counts.push_back(maxThreads);
+    return counts;
+}
+
+void run_scaling_benchmarks(BenchmarkHarness& harness, std::size_t maxThreads) {
+    // A family of cubics x³ + 4x² - 10 - s_i with roots spread over [1.36, 1.5]
+    const std::size_t largest = std::size_t(1) << 18;
+    std::vector<double> shifts(largest), initial(largest, 1.5), left(largest, 1.0), right(largest, 2.0);
+    for (std::size_t i = 0; i < largest; i++) {
+        shifts[i] = static_cast<double>(i % 1000) / 1000;
+    }
+    auto family = [&shifts](std::size_t i, auto x) { return x * x * x + 4 * x * x - 10 - shifts[i]; };
+    // The same family computing in the type of x, so float lanes stay in float
+    auto mixedFamily = [&shifts]<typename T>(std::size_t i, T x) { return x * x * x + 4 * x * x - 10 - T(shifts[i]); };
+    std::vector<double> roots(largest);
+    std::vector<SolveStatus> status(largest);
+
+    auto results = [&](std::size_t batch) {
+        return BatchResults{std::span<double>(roots).first(batch), std::span<SolveStatus>(status).first(batch), {}};
+    };
+    auto first = [](const std::vector<double>& v, std::size_t batch) { return std::span<const double>(v).first(batch); };
+
+    // Batch size curve of the single-threaded engines
+    for (std::size_t batch = 64; batch <= largest; batch *= 16) {
+        harness.run_scaling("batch_newton_raphson", 1, batch, [&] {
+            return batch_newton_raphson_solver(first(initial, batch), family, results(batch), tolerance, maxIterations);
+        });
+        harness.run_scaling("mixed_precision_newton", 1, batch, [&] {
+            return mixed_precision_newton_solver(first(initial, batch), mixedFamily, results(batch)).converged;
+        });
+        harness.run_scaling("batch_bisection", 1, batch, [&] {
+            return batch_bisection_solver(first(left, batch), first(right, batch), family, results(batch), tolerance,
+                                          maxIterations);
+        });
+        harness.run_scaling("batch_false_position", 1, batch, [&] {
+            return batch_false_position_solver(first(left, batch), first(right, batch), family, results(batch),
+                                               tolerance, maxIterations);
+        });
+        // Every solve in flight at once, one batched evaluation call per scheduler tick
+        harness.run_scaling("async_brent", 1, batch, [&] {
+            EvaluationScheduler<> scheduler;
+            for (std::size_t i = 0; i < batch; i++) {
+                scheduler.spawn(async_brent_solver(scheduler, 1.0, 2.0, tolerance, maxIterations));
+            }
+            scheduler.run([&](std::span<const std::size_t> solves, std::span<const double> x, std::span<double> y) {
+                for (std::size_t k = 0; k < x.size(); k++) {
+                    y[k] = family(solves[k], x[k]);
+                }
+            });
+            std::size_t converged = 0;
+            for (const SolveResult& result : scheduler.results()) {
+                converged += result.converged();
+            }
+            return converged;
+        });
+        harness.run_scaling("scalar_newton_raphson_loop", 1, batch, [&] {
+            std::size_t converged = 0;
+            for (std::size_t i = 0; i < batch; i++) {
+                auto f = [&family, i](auto x) { return family(i, x); };
+                SolveResult result = try_newton_raphson_solver(initial[i], f, tolerance, maxIterations);
+                roots[i] = result.root;
+                converged += result.converged();
+            }
+            return converged;
+        });
+    }
+
+    // The largest batch once more, streamed from a memory-mapped input file into a mapped output file
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        const std::string inputPath = (directory / "solver-benchmarks-stream-input.bin").string();
+        const std::string outputPath = (directory / "solver-benchmarks-stream-output.bin").string();
+        {
+            StreamInputWriter writer(inputPath, StreamLayout{largest, 1, 1, streamBlockSize});
+            for (std::size_t b = 0; b < writer.layout().block_count(); b++) {
+                WritableStreamBlock block = writer.block(b);
+                for (std::size_t i = 0; i < block.size; i++) {
+                    block.parameter(0)[i] = shifts[block.first + i];
+                    block.bound(0)[i] = initial[block.first + i];
+                }
+            }
+        }
+        auto streamFamily = [](const StreamRecord& p, auto x) { return x * x * x + 4 * x * x - 10 - p[0]; };
+        harness.run_scaling("stream_newton_raphson", 1, largest, [&] {
+            return stream_newton_raphson_solver(inputPath, outputPath, streamFamily, tolerance, maxIterations).converged;
+        });
+        std::filesystem::remove(inputPath);
+        std::filesystem::remove(outputPath);
+    }
+
+    // Thread scaling of the parallel drivers and the all-roots finder
+    for (std::size_t threads : thread_counts(maxThreads)) {
+        WorkStealingPool pool(threads);
+        harness.run_scaling("parallel_batch_newton_raphson", threads, largest, [&] {
+            return parallel_batch_newton_raphson_solver(pool, initial, family, results(largest), tolerance,
+                                                        maxIterations).converged;
+        });
+        harness.run_scaling("parallel_batch_bisection", threads, largest, [&] {
+            return parallel_batch_bisection_solver(pool, left, right, family, results(largest), tolerance,
+                                                   maxIterations).converged;
+        });
+        harness.run_scaling("parallel_batch_false_position", threads, largest, [&] {
+            return parallel_batch_false_position_solver(pool, left, right, family, results(largest), tolerance,
+                                                        maxIterations).converged;
+        });
+        // sin(x) + sin(3x)/3 on [0, 2000], whose roots are the multiples of π
+        auto findAll = [&] {
+            return find_all_roots(pool, 0.0, 2000.0, [](double x) { return std::sin(x) + std::sin(3 * x) / 3; },
+                                  tolerance).roots.size();
+        };
+        harness.run_scaling("find_all_roots", threads, findAll(), findAll);
+        // The same reusing one workspace and report, allocation-free after the first run
+        SolverWorkspace workspace;
+        AllRootsReport report;
+        harness.run_scaling("find_all_roots_workspace", threads, findAll(), [&] {
+            return find_all_roots(pool, workspace, 0.0, 2000.0, [](double x) { return std::sin(x) + std::sin(3 * x) / 3; },
+                                  report, tolerance).roots.size();
+        });
+        // One root of an objective costing about a microsecond per call, the case k-section is for
+        auto expensive = [](double x) {
+            double sum = 0;
+            for (int j = 0; j < 256; j++) {
+                sum += std::cos(x + j * 1e-12);
+            }
+            return sum / 256 - x;
+        };
+        harness.run_scaling("ksection", threads, 1, [&] {
+            return std::size_t(try_ksection_solver(pool, 0.0, 2.0, expensive, 1e-12, maxIterations).converged());
+        });
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkHarness harness;
+    std::string jsonPath;
+    std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+            harness.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue) {
+            harness.minTime = std::chrono::duration<double>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--samples") == 0 && hasValue) {
+            harness.samples = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--max-threads") == 0 && hasValue) {
+            maxThreads = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s [--json file] [--filter text] [--min-time seconds] [--samples n] [--max-threads n]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+
+    run_solver_benchmarks(harness);
+    run_scaling_benchmarks(harness, maxThreads);
+
+    if (!jsonPath.empty() && !harness.write_json(jsonPath)) {
+        std::fprintf(stderr, "could not write %s\n", jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef TEST_FUNCTIONS_H
+#define TEST_FUNCTIONS_H
+
+#include <cmath>
+#include <tuple>
+
+// Corpus of test problems for the benchmark suite.
+//
+// Every problem is a type with a generic call operator, so the solvers see the function exactly as
+// a user would pass it: inlined, and differentiable with dual numbers and Taylor jets. Each has a
+// bracket [a, b] that contains one root and across which the sign changes, a starting point x0 for
+// the open methods, and the root itself for checking, to rootTolerance where a problem sets one.
+// The categories group what makes a problem hard for some methods:
+//
+//   polynomial      smooth, well-conditioned simple roots
+//   transcendental  simple roots of functions with exp, cos and friends
+//   multiple        roots of odd multiplicity, where Newton-type methods converge only linearly
+//   flat            regions of nearly vanishing slope away from the root, which throw open methods far off
+
+struct CubicProblem {
+    static constexpr const char* name = "cubic";
+    static constexpr const char* category = "polynomial";
+    static constexpr double a = 1, b = 2, x0 = 1.5, root = 1.3652300134140969;
+
+    template <typename T>
+    T operator()(T x) const { return x * x * x + 4 * x * x - 10; }
+};
+
+// (x - 1)(x - 2)(x - 3)(x - 4)(x - 5), around the root at 3
+struct QuinticProblem {
+    static constexpr const char* name = "quintic";
+    static constexpr const char* category = "polynomial";
+    static constexpr double a = 2.5, b = 3.4, x0 = 3.2, root = 3;
+
+    template <typename T>
+    T operator()(T x) const { return (x - 1) * (x - 2) * (x - 3) * (x - 4) * (x - 5); }
+};
+
+struct CosineProblem {
+    static constexpr const char* name = "cos(x)-x";
+    static constexpr const char* category = "transcendental";
+    static constexpr double a = 0, b = 1, x0 = 0.5, root = 0.7390851332151607;
+
+    template <typename T>
+    T operator()(T x) const {
+        using std::cos;
+        return cos(x) - x;
+    }
+};
+
+struct ExponentialProblem {
+    static constexpr const char* name = "x*exp(x)-1";
+    static constexpr const char* category = "transcendental";
+    static constexpr double a = 0, b = 1, x0 = 0.5, root = 0.5671432904097838;
+
+    template <typename T>
+    T operator()(T x) const {
+        using std::exp;
+        return x * exp(x) - 1;
+    }
+};
+
+struct TripleRootProblem {
+    static constexpr const char* name = "(x-1)^3*exp(x)";
+    static constexpr const char* category = "multiple";
+    static constexpr double a = 0, b = 2.5, x0 = 2, root = 1;
+    // A residual of 1e-10 pins a triple root only to about its cube root
+    static constexpr double rootTolerance = 1e-3;
+
+    template <typename T>
+    T operator()(T x) const {
+        using std::exp;
+        return (x - 1) * (x - 1) * (x - 1) * exp(x);
+    }
+};
+
+// Nearly -1 on [0, 0.9]; the bracket starts at 0.5 so that the secant point of its ends is not x ≈ 0
+struct HighPowerProblem {
+    static constexpr const char* name = "x^20-1";
+    static constexpr const char* category = "flat";
+    static constexpr double a = 0.5, b = 2, x0 = 0.6, root = 1;
+
+    template <typename T>
+    T operator()(T x) const {
+        T x2 = x * x, x4 = x2 * x2, x8 = x4 * x4, x16 = x8 * x8;
+        return x16 * x4 - 1;
+    }
+};
+
+struct ArctanProblem {
+    static constexpr const char* name = "atan(x-2)";
+    static constexpr const char* category = "flat";
+    static constexpr double a = -10, b = 12, x0 = 0.5, root = 2;
+
+    template <typename T>
+    T operator()(T x) const {
+        using std::atan;
+        return atan(x - 2);
+    }
+};
+
+using TestCorpus = std::tuple<CubicProblem, QuinticProblem, CosineProblem, ExponentialProblem, TripleRootProblem,
+                              HighPowerProblem, ArctanProblem>;
+
+// Calls `visit(problem)` for every problem of the corpus.
+template <typename Visit>
+void for_each_test_problem(Visit&& visit) {
+    std::apply([&](auto... problems) { (visit(problems), ...); }, TestCorpus{});
+}
+
+#endif //TEST_FUNCTIONS_H
@@ -4,65 +4,225 @@
 
 #include "accelerated-solvers.h"
 
-#include <iomanip>
-#include <iostream>
-#include <ostream>
-#include <stdexcept>
-#include <cmath>  // For std::abs
+#include <limits>
+
+#include "solver-metrics.h"
 
 /**
- * Steffensen's method for solving fixed-point problems.
- *
- * This function implements Steffensen's method to accelerate the convergence
- * of a fixed-point iteration using Aitken's Δ² process. The method approximates
- * the solution to the equation f(p_hat) = 0.
- *
- * @param initialPoint The starting point for the iteration.
- * @param function A function pointer representing the function to be solved.
- * @param tolerance The stopping criterion: when the absolute difference between
- *        consecutive estimates is less than this value, the iteration stops.
- * @param maxIterations The maximum number of iterations to perform.
- * @return The approximate solution (fixed point) to the equation f(p_hat) = 0.
- * @throws std::runtime_error if the method does not converge within the specified
- *         number of iterations.
+ * Function-pointer overload of Steffensen's method, see accelerated-solvers.h. Reports into the
+ * metrics registry as "steffensen" while metering is enabled (see solver-metrics.h).
  */
 double steffensen_solver(double initialPoint, double (*function)(double), double tolerance, int maxIterations) {
-    int i = 1;  // Iteration counter
+    static SolverMetrics& metrics = solver_metrics("steffensen");
+    SolveResult result = metered_solve(metrics, [function](double x) { return function(x); }, [&](auto& f) {
+        return try_steffensen_solver(initialPoint, f, tolerance, maxIterations, TablePrinter{});
+    });
+    return detail::steffensen_root(result, maxIterations);
+}
+
+double AitkenAccelerator::push(double x) {
+    if (count < 2) {
+        (count == 0 ? x0 : x1) = x;
+        count++;
+        return x;
+    }
+    double d1 = x1 - x0;
+    double d2 = x - x1;
+    double denominator = d2 - d1;
+    double scale = std::max({std::abs(x0), std::abs(x1), std::abs(x)});
+    double estimate = x - d2 * d2 / denominator;
+    x0 = x1;
+    x1 = x;
+    // The differences carry rounding errors of about eps·scale; below that the step is noise
+    if (!(std::abs(denominator) > 4 * std::numeric_limits<double>::epsilon() * scale) || !std::isfinite(estimate)) {
+        return x;
+    }
+    return estimate;
+}
 
-    // Set up console output formatting for iteration results
-    std::cout << std::fixed << std::setprecision(6);
-    std::cout << std::setw(10) << "Iteration" << std::setw(15) << "p_hat"
-              << std::setw(15) << "f(p_hat)" << std::endl;
+WynnEpsilonAccelerator::WynnEpsilonAccelerator(std::size_t columns) : diagonal(columns + 1) {}
 
-    double p0 = initialPoint;  // Initial guess for the solution
+double WynnEpsilonAccelerator::push(double x) {
+    // Builds the new anti-diagonal over the old one: ε_(k+1) = ε_(k-1)(old) + 1 / (ε_k(new) - ε_k(old))
+    const double eps = std::numeric_limits<double>::epsilon();
+    std::size_t limit = std::min(length + 1, diagonal.size());
+    double previousOld = 0;     // ε_(-1) = 0
+    double current = x;
+    std::size_t k = 0;
+    while (true) {
+        double old = diagonal[k];
+        diagonal[k] = current;
+        k++;
+        if (k >= limit) {
+            break;
+        }
+        double difference = current - old;
+        if (!(std::abs(difference) > 4 * eps * std::max(std::abs(current), std::abs(old)))) {
+            break;  // the table breaks down here, keep the columns below
+        }
+        double next = previousOld + 1 / difference;
+        if (!std::isfinite(next)) {
+            break;
+        }
+        previousOld = old;
+        current = next;
+    }
+    length = k;
+    return diagonal[(length - 1) & ~std::size_t(1)];
+}
 
-    while (i <= maxIterations) {
-        // Compute successive function values to apply Aitken's Δ² process
-        double p1 = function(p0);  // First function evaluation
-        double p2 = function(p1);  // Second function evaluation
+RichardsonAccelerator::RichardsonAccelerator(double ratio, std::size_t levels, double order, double step)
+    : row(levels + 1), factors(levels) {
+    if (!(ratio > 1) || !(order > 0) || !(step > 0) || levels == 0) {
+        throw std::invalid_argument("Richardson extrapolation needs ratio > 1, order > 0, step > 0 and at least one level.");
+    }
+    for (std::size_t k = 0; k < levels; k++) {
+        factors[k] = std::pow(ratio, order + static_cast<double>(k) * step) - 1;
+    }
+}
 
-        // Compute the accelerated estimate using Aitken's Δ² method
-        double denominator = p2 - 2 * p1 + p0;
-        if (std::abs(denominator) < 1e-12) {  // Prevent division by zero
-            throw std::runtime_error("Denominator near zero, method fails at iteration " + std::to_string(i));
+double RichardsonAccelerator::push(double x) {
+    // R(n+1, k) = R(n+1, k-1) + (R(n+1, k-1) - R(n, k-1)) / (ratio^(order+(k-1)·step) - 1)
+    std::size_t limit = std::min(length + 1, row.size());
+    double old = row[0];
+    row[0] = x;
+    std::size_t k = 1;
+    for (; k < limit; k++) {
+        double value = row[k - 1] + (row[k - 1] - old) / factors[k - 1];
+        if (!std::isfinite(value)) {
+            break;
         }
-        double p = p0 - (p1 - p0) * (p1 - p0) / denominator;
+        old = row[k];
+        row[k] = value;
+    }
+    length = k;
+    return row[length - 1];
+}
 
-        // Output current iteration result
-        std::cout << std::setw(10) << i
-                  << std::setw(15) << p
-                  << std::setw(15) << function(p) << std::endl;
+AndersonAccelerator::AndersonAccelerator(std::size_t dimension, std::size_t depth, double mixing)
+    : n(dimension), depth(depth), mixing(mixing),
+      storage(std::make_unique<SolverWorkspace>(required_bytes(dimension, depth))) {
+    carve(*storage);
+}
 
-        // Check if the result is within the specified tolerance
-        if (std::abs(p - p0) < tolerance) {
-            return p;  // Convergence achieved
+AndersonAccelerator::AndersonAccelerator(SolverWorkspace& arena, std::size_t dimension, std::size_t depth,
+                                         double mixing)
+    : n(dimension), depth(depth), mixing(mixing) {
+    carve(arena);
+}
+
+std::size_t AndersonAccelerator::required_bytes(std::size_t dimension, std::size_t depth) {
+    auto padded = [](std::size_t bytes) {
+        return (bytes + SolverWorkspace::alignment - 1) / SolverWorkspace::alignment * SolverWorkspace::alignment;
+    };
+    return 3 * padded(dimension * sizeof(double)) + 3 * padded(depth * dimension * sizeof(double))
+           + padded(depth * depth * sizeof(double)) + padded(depth * sizeof(double))
+           + padded(depth * sizeof(std::size_t));
+}
+
+void AndersonAccelerator::carve(SolverWorkspace& arena) {
+    previousX = arena.allocate_array<double>(n);
+    previousF = arena.allocate_array<double>(n);
+    residual = arena.allocate_array<double>(n);
+    deltaX = arena.allocate_array<double>(depth * n);
+    deltaF = arena.allocate_array<double>(depth * n);
+    q = arena.allocate_array<double>(depth * n);
+    r = arena.allocate_array<double>(depth * depth);
+    gamma = arena.allocate_array<double>(depth);
+    columns = arena.allocate_array<std::size_t>(depth);
+}
+
+void AndersonAccelerator::push(std::span<const double> x, std::span<const double> gx, std::span<double> next) {
+    if (x.size() != n || gx.size() != n || next.size() != n) {
+        throw std::invalid_argument("The iterate, its image and the next iterate must have the accelerator's dimension.");
+    }
+    for (std::size_t j = 0; j < n; j++) {
+        residual[j] = gx[j] - x[j];
+    }
+    if (depth > 0) {
+        if (hasPrevious) {
+            double* dx = &deltaX[head * n];
+            double* df = &deltaF[head * n];
+            for (std::size_t j = 0; j < n; j++) {
+                dx[j] = x[j] - previousX[j];
+                df[j] = residual[j] - previousF[j];
+            }
+            head = (head + 1) % depth;
+            history = std::min(history + 1, depth);
         }
+        std::copy(x.begin(), x.end(), previousX.begin());
+        std::copy(residual.begin(), residual.end(), previousF.begin());
+        hasPrevious = true;
+    }
 
-        // Update the previous estimate for the next iteration
-        p0 = p;
-        i++;  // Increment iteration counter
+    // Modified Gram-Schmidt on the columns of ΔF, oldest first, leaving out nearly dependent ones
+    std::size_t kept = 0;
+    for (std::size_t c = 0; c < history; c++) {
+        std::size_t column = (head + depth - history + c) % depth;
+        double* qk = &q[kept * n];
+        const double* df = &deltaF[column * n];
+        double norm0 = 0;
+        for (std::size_t j = 0; j < n; j++) {
+            qk[j] = df[j];
+            norm0 += df[j] * df[j];
+        }
+        for (std::size_t i = 0; i < kept; i++) {
+            const double* qi = &q[i * n];
+            double dot = 0;
+            for (std::size_t j = 0; j < n; j++) {
+                dot += qi[j] * qk[j];
+            }
+            r[i * depth + kept] = dot;
+            for (std::size_t j = 0; j < n; j++) {
+                qk[j] -= dot * qi[j];
+            }
+        }
+        double norm = 0;
+        for (std::size_t j = 0; j < n; j++) {
+            norm += qk[j] * qk[j];
+        }
+        norm = std::sqrt(norm);
+        if (!(norm > 1e-10 * std::sqrt(norm0))) {
+            continue;
+        }
+        r[kept * depth + kept] = norm;
+        for (std::size_t j = 0; j < n; j++) {
+            qk[j] /= norm;
+        }
+        columns[kept] = column;
+        kept++;
     }
 
-    // If the loop exits without converging, throw an exception
-    throw std::runtime_error("No solution found after " + std::to_string(maxIterations) + " iterations.");
+    // γ = R⁻¹ Qᵀ f
+    bool finite = true;
+    for (std::size_t i = 0; i < kept; i++) {
+        const double* qi = &q[i * n];
+        double dot = 0;
+        for (std::size_t j = 0; j < n; j++) {
+            dot += qi[j] * residual[j];
+        }
+        gamma[i] = dot;
+    }
+    for (std::size_t i = kept; i-- > 0;) {
+        for (std::size_t l = i + 1; l < kept; l++) {
+            gamma[i] -= r[i * depth + l] * gamma[l];
+        }
+        gamma[i] /= r[i * depth + i];
+        finite = finite && std::isfinite(gamma[i]);
+    }
+    if (!finite) {
+        fallbackCount++;
+        history = 0;
+        kept = 0;
+    }
+
+    // x_(k+1) = x_k - ΔX γ + mixing·(f_k - ΔF γ), written element by element so `next` may alias `x`
+    for (std::size_t j = 0; j < n; j++) {
+        double value = x[j] + mixing * residual[j];
+        for (std::size_t i = 0; i < kept; i++) {
+            std::size_t column = columns[i];
+            value -= gamma[i] * (deltaX[column * n + j] + mixing * deltaF[column * n + j]);
+        }
+        next[j] = value;
+    }
 }
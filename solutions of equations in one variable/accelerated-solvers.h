@@ -5,5 +5,463 @@
 #ifndef ACCELERATED_SOLVERS_H
 #define ACCELERATED_SOLVERS_H
 
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "solve-result.h"
+#include "solver-error.h"
+#include "solver-observers.h"
+#include "solver-workspace.h"
+#include "stopping-criteria.h"
+
+double steffensen_solver(double initialPoint, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1000000);
+
+/**
+ * Steffensen's method for solving fixed-point problems, without throwing.
+ *
+ * This function implements Steffensen's method to accelerate the convergence
+ * of a fixed-point iteration using Aitken's Δ² process. The method approximates
+ * the solution to the equation f(p_hat) = 0. Every iteration costs two evaluations of
+ * function: the value at the accelerated estimate, which the table reports, is reused as the
+ * first evaluation of the next iteration.
+ *
+ * Header-only version accepting any callable; the function-pointer overload above forwards to it
+ * and prints the iteration table, this version is quiet unless an observer is passed in.
+ *
+ * @param initialPoint The starting point for the iteration.
+ * @param function The callable representing the function to be solved.
+ * @param tolerance The stopping criterion: when the absolute difference between
+ *        consecutive estimates is less than this value, the iteration stops.
+ * @param maxIterations The maximum number of iterations to perform.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `DenominatorTooSmall` if the Aitken denominator
+ *         vanishes before the iteration has converged, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_steffensen_solver(double initialPoint, F&& function, double tolerance = 1e-6, int maxIterations = 1000000,
+                                  Observer&& observer = Observer{}) {
+    SolveResult result;
+    int i = 1;  // Iteration counter
+
+    detail::start_table(observer, "steffensen", {{"Iteration", 10}, {"p_hat", 15}, {"f(p_hat)", 15}});
+
+    double p0 = initialPoint;  // Initial guess for the solution
+    result.root = p0;
+    if (maxIterations < 1) {
+        result.status = SolveStatus::MaxIterationsReached;
+        return result;
+    }
+    double p1 = function(p0);  // g(p0); every later one is the g(p) of the previous iteration
+    result.evaluations = 1;
+
+    while (i <= maxIterations) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        // Compute successive function values to apply Aitken's Δ² process
+        double p2 = function(p1);  // Second function evaluation
+        result.evaluations++;
+        result.iterations = i;
+
+        // Compute the accelerated estimate using Aitken's Δ² method
+        double denominator = p2 - 2 * p1 + p0;
+        if (std::abs(denominator) < 1e-12) {  // Prevent division by zero
+            // The differences, and with them the denominator, also vanish once the iteration has
+            // converged to rounding: a last plain step below the tolerance is convergence
+            if (std::abs(p1 - p0) < tolerance) {
+                result.root = p1;
+                result.fRoot = p2 - p1;
+                result.status = SolveStatus::Converged;
+                return result;
+            }
+            result.fRoot = p1 - p0;
+            result.status = SolveStatus::DenominatorTooSmall;
+            return result;
+        }
+        double p = p0 - (p1 - p0) * (p1 - p0) / denominator;
+        double fp = function(p);
+        result.evaluations++;
+        result.root = p;
+        result.fRoot = fp - p;
+
+        // Output current iteration result
+        observer.on_iteration(i, {p, fp});
+
+        // Check if the result is within the specified tolerance
+        if (std::abs(p - p0) < tolerance) {
+            result.status = SolveStatus::Converged;
+            return result;  // Convergence achieved
+        }
+
+        // Update the previous estimate for the next iteration, reusing g(p) as its first evaluation
+        p0 = p;
+        p1 = fp;
+        i++;  // Increment iteration counter
+    }
+
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+namespace detail {
+
+// The root of a try_steffensen_solver() result, or the exception steffensen_solver() raises for it.
+inline double steffensen_root(const SolveResult& result, int maxIterations) {
+    if (result.status == SolveStatus::DenominatorTooSmall) {
+        throw SolverError(result.status, "Denominator near zero, method fails at iteration ", result.iterations, "");
+    }
+    if (!result.converged()) {
+        // If the loop exits without converging, throw an exception
+        throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+    }
+    return result.root;
+}
+
+} // namespace detail
+
+/**
+ * Steffensen's method for solving fixed-point problems.
+ *
+ * Throwing form of try_steffensen_solver().
+ *
+ * @return The approximate solution (fixed point) to the equation f(p_hat) = 0.
+ * @throws std::runtime_error if the Aitken denominator vanishes or the method does not converge
+ *         within the specified number of iterations.
+ */
+template <typename F, typename Observer = NullObserver>
+double steffensen_solver(double initialPoint, F&& function, double tolerance = 1e-6, int maxIterations = 1000000,
+                         Observer&& observer = Observer{}) {
+    return detail::steffensen_root(try_steffensen_solver(initialPoint, std::forward<F>(function), tolerance,
+                                                         maxIterations, std::forward<Observer>(observer)), maxIterations);
+}
+
+// Sequence accelerators
+//
+// An accelerator takes the iterates x_0, x_1, ... of a slowly converging sequence one at a time
+// through push(x) and returns its current estimate of the limit. Until it has seen enough iterates,
+// and whenever the extrapolation breaks down (a vanishing difference, a non-finite result), it
+// returns the plain iterate instead of throwing, so it can be put on any iterate stream: a
+// fixed-point iteration, partial sums of a series, or the approximations of a discretization.
+//
+//     AitkenAccelerator aitken;
+//     for (double x = 1.5; ; x = g(x)) {
+//         double estimate = aitken.push(x);
+//         ...
+//     }
+//
+// Accelerators stack: stacked(first, second) feeds the estimates of `first` to `second`
+// (stacked(AitkenAccelerator{}, AitkenAccelerator{}) is the iterated Aitken process), and
+// try_accelerated_fixed_point_solver() runs a fixed-point iteration through any of them. The
+// vector AndersonAccelerator mixes the previous steps into the next iterate instead and therefore
+// drives the iteration itself, see anderson_fixed_point_solver().
+
+// Requirements on an accelerator of scalar iterate streams.
+template <typename A>
+concept SequenceAccelerator = requires(A& accelerator, double x) {
+    { accelerator.push(x) } -> std::convertible_to<double>;
+    accelerator.reset();
+};
+
+/**
+ * @brief Aitken's Δ² process on the last three iterates.
+ *
+ * Exact in one step for a sequence x_n = x + c·q^n converging linearly. Returns the plain iterate for
+ * the first two iterates and when the second difference is lost in rounding.
+ */
+class AitkenAccelerator {
+public:
+    double push(double x);
+    void reset() { count = 0; }
+
+private:
+    double x0 = 0, x1 = 0;
+    int count = 0;
+};
+
+/**
+ * @brief Wynn's epsilon algorithm, the Shanks transformation of the stream.
+ *
+ * Keeps the last anti-diagonal of the epsilon table, up to `columns` columns, and returns its
+ * highest even column. Column 2k is exact for a sequence whose error is a sum of k geometric terms,
+ * so it handles alternating and oscillating convergence that defeats a single Aitken step.
+ * Where a difference vanishes the diagonal is cut there and the estimate taken from the columns
+ * below the cut. All storage is allocated by the constructor.
+ */
+class WynnEpsilonAccelerator {
+public:
+    explicit WynnEpsilonAccelerator(std::size_t columns = 6);
+
+    double push(double x);
+    void reset() { length = 0; }
+
+private:
+    std::vector<double> diagonal;   // ε_k^(n-k), k = 0 .. length - 1, for the last iterate n
+    std::size_t length = 0;
+};
+
+/**
+ * @brief Richardson extrapolation of a stream with a known error expansion.
+ *
+ * For iterates A(h), A(h / ratio), A(h / ratio²), ... of an approximation whose error is
+ * c_1 h^order + c_2 h^(order+step) + c_3 h^(order+2·step) + ..., each of the `levels` levels of the
+ * Neville table removes one term; central differences and the trapezoidal rule have order = 2,
+ * step = 2. A fixed-point iteration converging linearly with a known rate λ is the case
+ * ratio = 1/λ, order = 1, levels = 1. Returns the plain iterate until the first level is available
+ * and keeps the highest finite level.
+ */
+class RichardsonAccelerator {
+public:
+    /**
+     * @throws std::invalid_argument If ratio is not greater than 1, order or step is not positive or
+     *         levels is zero.
+     */
+    explicit RichardsonAccelerator(double ratio, std::size_t levels = 2, double order = 1, double step = 1);
+
+    double push(double x);
+    void reset() { length = 0; }
+
+private:
+    std::vector<double> row;        // R(n, k), k = 0 .. length - 1, for the last iterate n
+    std::vector<double> factors;    // ratio^(order + k·step) - 1
+    std::size_t length = 0;
+};
+
+// Two accelerators in sequence, the estimates of `first` being the iterates of `second`.
+template <SequenceAccelerator First, SequenceAccelerator Second>
+struct StackedAccelerator {
+    First first;
+    Second second;
+
+    double push(double x) { return second.push(first.push(x)); }
+    void reset() {
+        first.reset();
+        second.reset();
+    }
+};
+
+template <SequenceAccelerator First, SequenceAccelerator Second>
+StackedAccelerator<std::decay_t<First>, std::decay_t<Second>> stacked(First&& first, Second&& second) {
+    return {std::forward<First>(first), std::forward<Second>(second)};
+}
+
+/**
+ * @brief Anderson mixing of depth m for vector fixed-point problems x = g(x).
+ *
+ * From the last m + 1 iterates and their images, the next iterate is the combination of the
+ * images whose residuals g(x) - x have the smallest least-squares combination, damped by `mixing`:
+ *
+ *     x_(k+1) = x_k - ΔX γ + mixing·(f_k - ΔF γ),   γ = argmin ||f_k - ΔF γ||,   f = g(x) - x.
+ *
+ * Depth 0, or mixing 1 with no history yet, is the plain iteration x_(k+1) = g(x_k). The least-squares
+ * problem is solved by modified Gram-Schmidt; columns that are nearly dependent on the previous ones
+ * are left out, and if the mix is not finite the history is dropped and the plain step taken. All
+ * storage, O(m·n), is taken by the constructor, from its own SolverWorkspace or from an arena.
+ */
+class AndersonAccelerator {
+public:
+    /**
+     * @param dimension The number of unknowns n.
+     * @param depth The number m of previous steps mixed in.
+     * @param mixing The damping β of the residual, in (0, 1].
+     */
+    AndersonAccelerator(std::size_t dimension, std::size_t depth = 5, double mixing = 1);
+
+    /**
+     * @brief Takes the buffers from `arena`; they are valid until the enclosing SolverWorkspace::Scope closes.
+     */
+    AndersonAccelerator(SolverWorkspace& arena, std::size_t dimension, std::size_t depth = 5, double mixing = 1);
+
+    /**
+     * @brief Takes the iterate x and its image gx = g(x) and writes the next iterate to `next`.
+     *
+     * `next` may alias `x` but not `gx`.
+     * @throws std::invalid_argument If a span does not have `dimension` elements.
+     */
+    void push(std::span<const double> x, std::span<const double> gx, std::span<double> next);
+
+    // Forgets the history, the next push() takes a plain (damped) step.
+    void reset() {
+        history = 0;
+        hasPrevious = false;
+    }
+
+    std::size_t dimension() const { return n; }
+
+    // Steps in which the history was dropped because the mix was not finite.
+    std::size_t fallbacks() const { return fallbackCount; }
+
+    // What an accelerator of this shape takes from a SolverWorkspace.
+    static std::size_t required_bytes(std::size_t dimension, std::size_t depth);
+
+private:
+    void carve(SolverWorkspace& arena);
+
+    std::size_t n, depth;
+    double mixing;
+    std::span<double> previousX, previousF, residual;
+    std::span<double> deltaX, deltaF;       // depth columns of n, ring buffer starting at `head`
+    std::span<double> q, r, gamma;          // Gram-Schmidt workspace
+    std::span<std::size_t> columns;         // ring positions of the columns kept by Gram-Schmidt
+    std::size_t head = 0, history = 0;
+    bool hasPrevious = false;
+    std::size_t fallbackCount = 0;
+    std::unique_ptr<SolverWorkspace> storage;   // the buffers, unless they come from an arena
+};
+
+/**
+ * Fixed-point iteration p = f(p0) through a sequence accelerator, without throwing.
+ *
+ * The accelerator only observes the plain iterates, which are not changed, so any accelerator
+ * (or stack of them) can be put on an iteration without affecting its convergence. The iteration
+ * stops once two consecutive estimates differ by less than `tolerance`.
+ *
+ * @param p0 The starting point.
+ * @param f The fixed-point map.
+ * @param accelerator The accelerator, e.g. AitkenAccelerator{} or WynnEpsilonAccelerator{}; it is reset first.
+ * @param tolerance The stopping criterion on consecutive estimates.
+ * @param maxIterations The maximum number of iterations.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult whose root is the last estimate and fRoot the last plain step f(p0) - p0;
+ *         status `Converged` or `MaxIterationsReached`.
+ */
+template <typename F, SequenceAccelerator Accelerator, typename Observer = NullObserver>
+SolveResult try_accelerated_fixed_point_solver(double p0, F&& f, Accelerator&& accelerator, double tolerance = 1e-6,
+                                               int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    SolveResult result;
+    accelerator.reset();
+    double estimate = accelerator.push(p0);
+    result.root = estimate;
+
+    detail::start_table(observer, "accelerated_fixed_point", {{"Iteration", 10}, {"p", 15}, {"estimate", 15}});
+
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        double p = f(p0);
+        double next = accelerator.push(p);
+        result.evaluations++;
+        result.iterations = i;
+        result.root = next;
+        result.fRoot = p - p0;
+        observer.on_iteration(i, {p, next});
+
+        if (std::abs(next - estimate) < tolerance) {
+            observer.on_converged(next);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        estimate = next;
+        p0 = p;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+// Outcome of anderson_fixed_point_solver().
+struct FixedPointReport {
+    SolveStatus status = SolveStatus::MaxIterationsReached;
+    int iterations = 0;
+    int evaluations = 0;        // evaluations of g
+    double residual = 0;        // max |g(x) - x| at the last evaluated x
+    std::size_t fallbacks = 0;  // steps taken without mixing, see AndersonAccelerator
+
+    bool converged() const { return status == SolveStatus::Converged; }
+};
+
+/**
+ * @brief Solves the vector fixed-point problem x = g(x) with Anderson mixing.
+ *
+ * g is called as `g(x, gx)` with `std::span<const double> x` and `std::span<double> gx` and writes
+ * g(x) to gx. The iteration stops once max |g(x) - x| < tolerance and leaves g(x) in `x`. The
+ * accelerator and gx are taken from `workspace`, so once it has grown to the size of the problem a
+ * solve does not allocate.
+ *
+ * @param x The starting point on entry, the fixed point on return.
+ * @param g The fixed-point map.
+ * @param workspace Where the history of the mixing and g(x) are kept.
+ * @param depth The depth m of the Anderson mixing; 0 is the plain iteration.
+ * @param tolerance The stopping criterion on the residual.
+ * @param maxIterations The maximum number of evaluations of g.
+ * @param mixing The damping of the residual (see AndersonAccelerator).
+ * @return FixedPointReport with the status, counters and final residual.
+ */
+template <typename G>
+FixedPointReport anderson_fixed_point_solver(std::span<double> x, G&& g, SolverWorkspace& workspace,
+                                             std::size_t depth = 5, double tolerance = 1e-6,
+                                             int maxIterations = 1000000, double mixing = 1) {
+    SolverWorkspace::Scope scope(workspace);
+    FixedPointReport report;
+    AndersonAccelerator anderson(workspace, x.size(), depth, mixing);
+    std::span<double> gx = workspace.allocate_array<double>(x.size());
+    for (int i = 1; i <= maxIterations; i++) {
+        g(std::span<const double>(x), gx);
+        report.evaluations++;
+        report.iterations = i;
+        report.residual = 0;
+        for (std::size_t j = 0; j < x.size(); j++) {
+            report.residual = std::max(report.residual, std::abs(gx[j] - x[j]));
+        }
+        if (report.residual < tolerance) {
+            std::copy(gx.begin(), gx.end(), x.begin());
+            report.status = SolveStatus::Converged;
+            break;
+        }
+        anderson.push(x, gx, x);
+    }
+    report.fallbacks = anderson.fallbacks();
+    return report;
+}
+
+/**
+ * @brief Solves the vector fixed-point problem x = g(x) with Anderson mixing.
+ *
+ * anderson_fixed_point_solver() with a workspace of its own.
+ */
+template <typename G>
+FixedPointReport anderson_fixed_point_solver(std::span<double> x, G&& g, std::size_t depth = 5,
+                                             double tolerance = 1e-6, int maxIterations = 1000000,
+                                             double mixing = 1) {
+    SolverWorkspace workspace(AndersonAccelerator::required_bytes(x.size(), depth) + x.size() * sizeof(double)
+                              + SolverWorkspace::alignment);
+    return anderson_fixed_point_solver(x, std::forward<G>(g), workspace, depth, tolerance, maxIterations, mixing);
+}
+
+// Overloads of the try_ solvers taking a StoppingCriteria instead of (tolerance, maxIterations)
+
+/**
+ * @brief try_steffensen_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_steffensen_solver(double initialPoint, F&& function, const StoppingCriteria& criteria,
+                                  Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(initialPoint);
+    return detail::solve_with_criteria(function, criteria, true, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_steffensen_solver(initialPoint, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_accelerated_fixed_point_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, SequenceAccelerator Accelerator, typename Observer = NullObserver>
+SolveResult try_accelerated_fixed_point_solver(double p0, F&& f, Accelerator&& accelerator,
+                                               const StoppingCriteria& criteria, Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(p0);
+    return detail::solve_with_criteria(f, criteria, true, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_accelerated_fixed_point_solver(p0, objective, accelerator, tolerance, criteria.maxIterations,
+                                                  budgetObserver);
+    });
+}
+
 #endif //ACCELERATED_SOLVERS_H
-double steffensen_solver(double initialPoint, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1e6);
\ No newline at end of file
@@ -0,0 +1,391 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef ALL_ROOTS_FINDER_H
+#define ALL_ROOTS_FINDER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bracketing-solvers.h"
+#include "memoized-objective.h"
+#include "solve-result.h"
+#include "solver-workspace.h"
+#include "work-stealing-pool.h"
+
+// All-roots finder: locates every root of f on a wide interval, without the caller having to supply
+// a sign-changing bracket for each one.
+//
+// It works in three phases, the first and the last running on a WorkStealingPool:
+//
+//   1. Sampling. f is evaluated on a uniform grid of `samples` subintervals of [leftBound, rightBound].
+//   2. Classification. Every subinterval whose end values have opposite signs becomes a bracket. A
+//      sample where |f| has a local minimum without a sign change around it becomes a suspect: it
+//      is either a root of even multiplicity (f touches zero) or a pair of roots closer together
+//      than the grid spacing. Any other subinterval where the samples suggest structure the grid
+//      does not resolve becomes a gap: either |f| at both of its ends is below the largest change of
+//      f between neighbouring samples, or f bends towards zero at one of its ends more sharply than
+//      at the samples around it, the trace of a dip narrower than the grid spacing.
+//   3. Solving. Brackets are solved with try_brent_solver(), which takes the values at their ends
+//      from the samples. Suspects are refined by recursive subdivision around the minimum of |f|;
+//      any sign change this uncovers is solved with Brent's method, and a minimum that shrinks
+//      below 2·tolerance with |f| <= tolerance is reported as a touching root. Gaps are sampled
+//      adaptively, halving up to allRootsGapDepth times towards the half that strays furthest from
+//      the slope of f around the gap, until a sign change (solved) or a minimum of |f| (refined as
+//      a suspect) shows up or the deviation fades the way it does on a smooth function.
+//
+// Every bracket, suspect and gap is an independent task, so on intervals with many roots the solve
+// phase scales with the number of threads; the roots are then sorted and roots closer than
+// 2·tolerance merged. f is called concurrently from all threads of the pool and must be safe to call
+// that way. The refinement only goes where the samples hint at something: a pair of roots in a
+// narrow spike between two samples that look like the rest of f, and touching roots at the two ends
+// of the interval, can still be missed; raise `samples` for such functions.
+//
+// The grid, the task list and the roots of every task live in a SolverWorkspace. The overload
+// taking one and an AllRootsReport refills the report in place, so repeated searches on the same
+// thread do not allocate once the workspace and the report have grown to the largest search.
+
+// Outcome of find_all_roots().
+struct AllRootsReport {
+    std::vector<double> roots;          // every root found, in ascending order, without duplicates
+    std::size_t brackets = 0;           // sign-changing brackets that were solved
+    std::size_t unresolved = 0;         // brackets whose solve did not converge, their roots are missing
+    std::size_t evaluations = 0;        // evaluations of f over all phases
+    std::vector<WorkerStats> workers;   // what every thread of the pool did during the solve phase
+};
+
+// Default number of grid subintervals for the sampling phase.
+inline constexpr std::size_t allRootsSampleCount = 4096;
+
+// Halvings of a gap in the adaptive sampling, down to 1/64 of the grid spacing.
+inline constexpr int allRootsGapDepth = 6;
+
+namespace detail {
+
+// Counters of one worker, padded so neighbouring workers do not share a cache line, and where the
+// roots of the task it is running go.
+struct alignas(64) RootSlot {
+    double* roots = nullptr;
+    std::size_t found = 0;
+    std::size_t brackets = 0;
+    std::size_t unresolved = 0;
+    std::size_t evaluations = 0;
+
+    void add(double root) { roots[found++] = root; }
+};
+
+// Room for the roots of one task: a bracket has one, a refined suspect at most four (one per
+// quarter of its last subdivision), a gap as many as the suspect it may end in
+inline constexpr std::size_t bracketRoots = 1;
+inline constexpr std::size_t suspectRoots = 4;
+inline constexpr std::size_t gapRoots = suspectRoots;
+
+// A sample x[i] where |f| has a local minimum and the neighbouring samples have the same sign.
+struct RootSuspect {
+    double a, m, b;
+    double fa, fm, fb;
+};
+
+// Solves the bracket [a, b] whose end values fa, fb are already known, without evaluating f there again.
+template <typename F>
+void solve_root_bracket(double a, double fa, double b, double fb, F& f, double tolerance, int maxIterations,
+                        RootSlot& slot) {
+    SolveResult result = try_brent_solver(a, b, KnownEndpoints<F>{f, a, fa, b, fb}, tolerance, maxIterations);
+    slot.brackets++;
+    slot.evaluations += result.evaluations - 2;
+    if (result.converged()) {
+        slot.add(result.root);
+    } else {
+        slot.unresolved++;
+    }
+}
+
+// Whether f bends towards zero at sample j more sharply than at the samples next to it: the second
+// difference points towards zero, is not rounding noise and is half again as large as both
+// neighbouring ones, which is what a dip narrower than the grid spacing leaves behind
+inline bool bends_towards_zero(std::span<const double> y, std::size_t j) {
+    auto second = [&](std::size_t k) {
+        return k > 0 && k + 1 < y.size() ? y[k + 1] - 2 * y[k] + y[k - 1] : 0.0;
+    };
+    if (j == 0 || j + 1 >= y.size()) {
+        return false;
+    }
+    double s = second(j);
+    double noise = 16 * std::numeric_limits<double>::epsilon()
+                   * (std::abs(y[j - 1]) + 2 * std::abs(y[j]) + std::abs(y[j + 1]));
+    return (y[j] > 0 ? s > 0 : s < 0) && std::abs(s) > noise && std::abs(s) > 1.5 * std::abs(second(j - 1))
+           && std::abs(s) > 1.5 * std::abs(second(j + 1));
+}
+
+// Whether the grid subinterval [x[i], x[i + 1]], whose end values have the same sign, may hide roots
+// (see the top of this file). y holds every sample.
+inline bool root_gap(std::span<const double> y, std::size_t i) {
+    double variation = std::abs(y[i + 1] - y[i]);
+    if (i > 0) {
+        variation = std::max(variation, std::abs(y[i] - y[i - 1]));
+    }
+    if (i + 2 < y.size()) {
+        variation = std::max(variation, std::abs(y[i + 2] - y[i + 1]));
+    }
+    return std::abs(y[i]) + std::abs(y[i + 1]) < variation || bends_towards_zero(y, i) || bends_towards_zero(y, i + 1);
+}
+
+// Halves [a, b] around the minimum of |f| until f changes sign inside it or the interval is
+// narrower than 2·tolerance. Invariant: |fm| < |fa| and |fm| < |fb|, all three of the same sign.
+template <typename F>
+void refine_root_suspect(RootSuspect s, F& f, double tolerance, int maxIterations, RootSlot& slot) {
+    while (s.b - s.a >= 2 * tolerance) {
+        double l = s.a + (s.m - s.a) / 2;
+        double r = s.m + (s.b - s.m) / 2;
+        if (l <= s.a || l >= s.m || r <= s.m || r >= s.b) {
+            break;  // no more doubles between the points
+        }
+        double x[5] = {s.a, l, s.m, r, s.b};
+        double y[5] = {s.fa, f(l), s.fm, f(r), s.fb};
+        slot.evaluations += 2;
+
+        bool signChange = false;
+        for (int k = 1; k <= 3; k += 2) {
+            if (y[k] == 0) {
+                slot.add(x[k]);
+                return;
+            }
+        }
+        for (int k = 0; k < 4; k++) {
+            if (!same_sign(y[k], y[k + 1])) {
+                solve_root_bracket(x[k], y[k], x[k + 1], y[k + 1], f, tolerance, maxIterations, slot);
+                signChange = true;
+            }
+        }
+        if (signChange) {
+            return;
+        }
+
+        int k = 1;
+        for (int j = 2; j <= 3; j++) {
+            if (std::abs(y[j]) < std::abs(y[k])) {
+                k = j;
+            }
+        }
+        s = {x[k - 1], x[k], x[k + 1], y[k - 1], y[k], y[k + 1]};
+    }
+    if (std::abs(s.fm) <= tolerance) {
+        slot.add(s.m);
+    }
+}
+
+// Samples the gap [x[i], x[i + 1]] adaptively. Every step halves the piece it is on and continues on
+// the half that strays further from the slope of f at the neighbouring samples, up to
+// allRootsGapDepth times, until a sign change (solved) or a minimum of |f| (refined as a suspect)
+// turns up. It gives up once the deviation falls to half that of the piece before: a smooth f
+// deviates four times less per halving, a dip the grid does not resolve does not.
+template <typename F>
+void refine_root_gap(std::span<const double> x, std::span<const double> y, std::size_t i, F& f, double tolerance,
+                     int maxIterations, RootSlot& slot) {
+    double slope = y[i + 1] - y[i];
+    if (i > 0 && i + 2 < y.size()) {
+        slope = (y[i] - y[i - 1] + y[i + 2] - y[i + 1]) / 2;
+    } else if (i > 0) {
+        slope = y[i] - y[i - 1];
+    } else if (i + 2 < y.size()) {
+        slope = y[i + 2] - y[i + 1];
+    }
+    slope /= x[i + 1] - x[i];
+
+    double a = x[i], b = x[i + 1], fa = y[i], fb = y[i + 1];
+    double deviation = std::abs(fb - fa - slope * (b - a));
+    for (int depth = 0; depth < allRootsGapDepth; depth++) {
+        double m = a + (b - a) / 2;
+        if (m <= a || m >= b) {
+            return;
+        }
+        double fm = f(m);
+        slot.evaluations++;
+
+        if (fm == 0) {
+            slot.add(m);
+            return;
+        }
+        bool left = !same_sign(fa, fm), right = !same_sign(fm, fb);
+        if (left) {
+            solve_root_bracket(a, fa, m, fm, f, tolerance, maxIterations, slot);
+        }
+        if (right) {
+            solve_root_bracket(m, fm, b, fb, f, tolerance, maxIterations, slot);
+        }
+        if (left || right) {
+            return;
+        }
+        if (std::abs(fm) < std::abs(fa) && std::abs(fm) < std::abs(fb)) {
+            refine_root_suspect({a, m, b, fa, fm, fb}, f, tolerance, maxIterations, slot);
+            return;
+        }
+
+        double leftDeviation = std::abs(fm - fa - slope * (m - a));
+        double rightDeviation = std::abs(fb - fm - slope * (b - m));
+        double next = std::max(leftDeviation, rightDeviation);
+        if (next < deviation / 2) {
+            return;
+        }
+        deviation = next;
+        if (leftDeviation >= rightDeviation) {
+            b = m;
+            fb = fm;
+        } else {
+            a = m;
+            fa = fm;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Finds every root of `f` on [leftBound, rightBound], using the threads of `pool`, allocation-free.
+ *
+ * Samples f on a grid, refined adaptively where the samples suggest unresolved roots, solves every
+ * sign change with Brent's method and refines local minima of |f| to catch roots of even
+ * multiplicity and closely spaced pairs (see the top of this file). The
+ * buffers come from `workspace` and the outcome is written to `report`, reusing its storage.
+ *
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable whose roots are being sought; called concurrently from all threads.
+ * @param tolerance The accuracy of every root; also the largest |f| accepted for a touching root.
+ * @param samples The number of grid subintervals used to detect roots before the adaptive refinement.
+ * @param maxIterations The maximum number of iterations of every bracket solve.
+ * @return `report`, with the sorted roots, counters and per-thread statistics.
+ * @throws std::invalid_argument If leftBound is not below rightBound or samples is less than 2.
+ */
+template <typename F>
+const AllRootsReport& find_all_roots(WorkStealingPool& pool, SolverWorkspace& workspace, double leftBound,
+                                     double rightBound, F&& f, AllRootsReport& report, double tolerance = 1e-10,
+                                     std::size_t samples = allRootsSampleCount, int maxIterations = 1000000) {
+    if (!(leftBound < rightBound) || samples < 2) {
+        throw std::invalid_argument("The interval must satisfy leftBound < rightBound and be sampled at least twice.");
+    }
+    SolverWorkspace::Scope scope(workspace);
+
+    // Phase 1: sample f on the grid
+    std::span<double> x = workspace.allocate_array<double>(samples + 1);
+    std::span<double> y = workspace.allocate_array<double>(samples + 1);
+    double spacing = (rightBound - leftBound) / static_cast<double>(samples);
+    std::size_t sampleGrain = std::max<std::size_t>(64, (samples + 1) / (8 * pool.thread_count()));
+    pool.parallel_for(samples + 1, sampleGrain, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; i++) {
+            x[i] = i == samples ? rightBound : leftBound + static_cast<double>(i) * spacing;
+            y[i] = f(x[i]);
+        }
+    });
+
+    // Phase 2: classify the grid into exact roots, brackets, suspects and gaps. A sample starts at
+    // most one bracket or suspect, so the grid indices of the brackets fill `tasks` from the front
+    // and those of the suspects from the back; gaps next to a suspect are left to the suspect.
+    report.roots.clear();
+    report.brackets = 0;
+    report.unresolved = 0;
+    report.evaluations = samples + 1;
+    std::span<std::size_t> tasks = workspace.allocate_array<std::size_t>(samples + 1);
+    std::span<std::size_t> gaps = workspace.allocate_array<std::size_t>(samples);
+    auto isSuspect = [&](std::size_t i) {
+        return i > 0 && i < samples && y[i] != 0 && detail::same_sign(y[i - 1], y[i])
+               && detail::same_sign(y[i], y[i + 1]) && std::abs(y[i]) < std::abs(y[i - 1])
+               && std::abs(y[i]) < std::abs(y[i + 1]);
+    };
+    std::size_t bracketCount = 0, suspectBegin = tasks.size(), gapCount = 0;
+    for (std::size_t i = 0; i <= samples; i++) {
+        if (y[i] == 0) {
+            report.roots.push_back(x[i]);
+            continue;
+        }
+        if (i < samples && y[i + 1] != 0 && !detail::same_sign(y[i], y[i + 1])) {
+            tasks[bracketCount++] = i;
+        } else if (isSuspect(i)) {
+            tasks[--suspectBegin] = i;
+        } else if (i < samples && y[i + 1] != 0 && !isSuspect(i + 1) && detail::root_gap(y, i)) {
+            gaps[gapCount++] = i;
+        }
+    }
+    const std::size_t suspectCount = tasks.size() - suspectBegin;
+
+    // Phase 3: solve every bracket, refine every suspect and sample every gap as independent tasks,
+    // each writing its roots to its own range of `found`; the slots no root was written to stay NaN
+    const std::size_t suspectOffset = bracketCount * detail::bracketRoots;
+    const std::size_t gapOffset = suspectOffset + suspectCount * detail::suspectRoots;
+    std::span<double> found = workspace.allocate_array<double>(gapOffset + gapCount * detail::gapRoots);
+    std::fill(found.begin(), found.end(), std::numeric_limits<double>::quiet_NaN());
+    std::span<detail::RootSlot> slots = workspace.allocate_array<detail::RootSlot>(pool.thread_count());
+    pool.parallel_for(bracketCount + suspectCount + gapCount, 1,
+                      [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        detail::RootSlot& slot = slots[worker];
+        for (std::size_t task = begin; task < end; task++) {
+            slot.found = 0;
+            if (task < bracketCount) {
+                std::size_t i = tasks[task];
+                slot.roots = &found[task * detail::bracketRoots];
+                detail::solve_root_bracket(x[i], y[i], x[i + 1], y[i + 1], f, tolerance, maxIterations, slot);
+            } else if (task < bracketCount + suspectCount) {
+                std::size_t suspect = task - bracketCount;
+                std::size_t i = tasks[suspectBegin + suspect];
+                slot.roots = &found[suspectOffset + suspect * detail::suspectRoots];
+                detail::refine_root_suspect({x[i - 1], x[i], x[i + 1], y[i - 1], y[i], y[i + 1]}, f, tolerance,
+                                            maxIterations, slot);
+            } else {
+                std::size_t gap = task - bracketCount - suspectCount;
+                std::size_t i = gaps[gap];
+                slot.roots = &found[gapOffset + gap * detail::gapRoots];
+                detail::refine_root_gap(x, y, i, f, tolerance, maxIterations, slot);
+            }
+        }
+    });
+    pool.last_run_stats(report.workers);
+
+    for (const detail::RootSlot& slot : slots) {
+        report.brackets += slot.brackets;
+        report.unresolved += slot.unresolved;
+        report.evaluations += slot.evaluations;
+    }
+    for (double root : found) {
+        if (!std::isnan(root)) {
+            report.roots.push_back(root);
+        }
+    }
+
+    // Sort and merge roots that were found twice, e.g. from both sides of a grid point
+    std::sort(report.roots.begin(), report.roots.end());
+    auto last = std::unique(report.roots.begin(), report.roots.end(), [tolerance](double p, double q) {
+        return q - p <= 2 * tolerance;
+    });
+    report.roots.erase(last, report.roots.end());
+    return report;
+}
+
+/**
+ * @brief Finds every root of `f` on [leftBound, rightBound], using the threads of `pool`.
+ *
+ * find_all_roots() with a workspace and a report of its own.
+ *
+ * @return AllRootsReport with the sorted roots, counters and per-thread statistics.
+ * @throws std::invalid_argument If leftBound is not below rightBound or samples is less than 2.
+ */
+template <typename F>
+AllRootsReport find_all_roots(WorkStealingPool& pool, double leftBound, double rightBound, F&& f,
+                              double tolerance = 1e-10, std::size_t samples = allRootsSampleCount,
+                              int maxIterations = 1000000) {
+    // The grid and the task lists; the roots of the tasks may take one more block
+    SolverWorkspace workspace((samples + 1) * (2 * sizeof(double) + 2 * sizeof(std::size_t))
+                              + pool.thread_count() * sizeof(detail::RootSlot) + 4 * SolverWorkspace::alignment);
+    AllRootsReport report;
+    find_all_roots(pool, workspace, leftBound, rightBound, std::forward<F>(f), report, tolerance, samples,
+                   maxIterations);
+    return report;
+}
+
+#endif //ALL_ROOTS_FINDER_H
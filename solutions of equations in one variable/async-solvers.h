@@ -0,0 +1,518 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef ASYNC_SOLVERS_H
+#define ASYNC_SOLVERS_H
+
+#include <algorithm>
+#include <cmath>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "derivative-policies.h"
+#include "solve-result.h"
+
+// Coroutine solvers for objectives evaluated asynchronously, e.g. by a remote service or a GPU
+// kernel, where a blocking call per evaluation would need one thread per solve in flight.
+//
+// The async_ solvers are coroutines that `co_await` every evaluation of f from an
+// EvaluationScheduler instead of calling f. The scheduler, driven by one thread, keeps any number of
+// solves in flight: each tick() collects the pending points of all suspended solves, evaluates them
+// with a single call of the batch evaluator, and resumes every solve with its values, which then run
+// on to their next evaluation. A tick therefore costs one round-trip however many solves are active:
+//
+//     EvaluationScheduler<> scheduler;
+//     for (std::size_t i = 0; i < problems; i++) {
+//         scheduler.spawn(async_brent_solver(scheduler, left[i], right[i], 1e-10));
+//     }
+//     scheduler.run([&](std::span<const double> x, std::span<double> y) { model.evaluate(x, y); });
+//     const std::vector<SolveResult>& results = scheduler.results();   // in spawn order
+//
+// The iterates are the same as those of the corresponding try_ solvers. An objective with
+// per-problem parameters takes the spawn() index of the solve each point belongs to as its first
+// argument, `evaluate(solves, x, y)`, and looks the parameters up itself.
+
+/**
+ * @brief A suspended solve of an async_ solver, to be handed to EvaluationScheduler::spawn().
+ *
+ * The solve does not start before the scheduler resumes it. Destroying a task that has not been
+ * spawned destroys the solve.
+ */
+class SolveTask {
+public:
+    struct promise_type {
+        SolveResult result;
+        std::exception_ptr error;
+        std::size_t id = 0;
+
+        SolveTask get_return_object() { return SolveTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_value(const SolveResult& value) { result = value; }
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    SolveTask(SolveTask&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    SolveTask& operator=(SolveTask&& other) noexcept {
+        if (this != &other) {
+            if (handle) {
+                handle.destroy();
+            }
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+    ~SolveTask() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    SolveTask(const SolveTask&) = delete;
+    SolveTask& operator=(const SolveTask&) = delete;
+
+    // Gives up ownership of the coroutine.
+    Handle release() { return std::exchange(handle, {}); }
+
+private:
+    explicit SolveTask(Handle handle) : handle(handle) {}
+
+    Handle handle;
+};
+
+/**
+ * @brief Single-threaded scheduler batching the evaluations of many in-flight async_ solves.
+ *
+ * `Value` is what one evaluation yields: double for f(x), or ValueAndDerivative when the evaluator
+ * returns f and f' together (which async_newton_raphson_solver() then uses). The batch evaluator
+ * is called as `evaluate(std::span<const double> points, std::span<Value> values)`, or as
+ * `evaluate(std::span<const std::size_t> solves, points, values)` with the spawn() index of the
+ * solve asking for each point when it accepts that, and has to fill one value per point.
+ */
+template <typename Value = double>
+class EvaluationScheduler {
+public:
+    // Awaitable of one point, resuming with its value.
+    struct PointEvaluation {
+        EvaluationScheduler* scheduler;
+        double point;
+        Value value{};
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(SolveTask::Handle handle) { scheduler->enqueue(handle, &point, &value, 1); }
+        Value await_resume() const noexcept { return value; }
+    };
+
+    // Awaitable of several points, evaluated in the same tick.
+    struct PointsEvaluation {
+        EvaluationScheduler* scheduler;
+        std::span<const double> points;
+        std::span<Value> values;
+
+        bool await_ready() const noexcept { return points.empty(); }
+        void await_suspend(SolveTask::Handle handle) {
+            scheduler->enqueue(handle, points.data(), values.data(), points.size());
+        }
+        void await_resume() const noexcept {}
+    };
+
+    EvaluationScheduler() = default;
+    ~EvaluationScheduler() {
+        for (const Request& request : pending) {
+            request.handle.destroy();
+        }
+        for (SolveTask::Handle handle : starting) {
+            handle.destroy();
+        }
+    }
+
+    EvaluationScheduler(const EvaluationScheduler&) = delete;
+    EvaluationScheduler& operator=(const EvaluationScheduler&) = delete;
+
+    // `co_await scheduler.evaluate(x)` inside a solve yields f(x) at the next tick.
+    PointEvaluation evaluate(double point) { return {this, point}; }
+
+    // `co_await scheduler.evaluate(points, values)` fills `values` with f at every point at the next tick.
+    PointsEvaluation evaluate(std::span<const double> points, std::span<Value> values) { return {this, points, values}; }
+
+    /**
+     * @brief Takes over a solve, which starts at the next tick.
+     * @return std::size_t Index of the result of this solve in results().
+     */
+    std::size_t spawn(SolveTask task) {
+        SolveTask::Handle handle = task.release();
+        handle.promise().id = solveResults.size();
+        solveResults.emplace_back();
+        starting.push_back(handle);
+        inFlight++;
+        return handle.promise().id;
+    }
+
+    /**
+     * @brief Starts the spawned solves, evaluates all pending points with one `evaluate` call and
+     *        resumes the solves waiting for them.
+     *
+     * If `evaluate` throws, the exception propagates and the waiting solves stay suspended, so a
+     * later tick retries their points. An exception escaping a solve is rethrown at the end of the
+     * tick, after the other solves have been resumed.
+     *
+     * @return std::size_t The number of solves still in flight.
+     */
+    template <typename Evaluate>
+    std::size_t tick(Evaluate&& evaluate) {
+        std::vector<SolveTask::Handle> started;
+        started.swap(starting);
+        for (SolveTask::Handle handle : started) {
+            resume(handle);
+        }
+        if (pending.empty()) {
+            return finish_tick();
+        }
+
+        waiting.clear();
+        waiting.swap(pending);
+        constexpr bool wantsSolves = std::is_invocable_v<Evaluate&, std::span<const std::size_t>, std::span<const double>,
+                                                         std::span<Value>>;
+        points.clear();
+        solves.clear();
+        for (const Request& request : waiting) {
+            points.insert(points.end(), request.points, request.points + request.count);
+            if constexpr (wantsSolves) {
+                solves.insert(solves.end(), request.count, request.handle.promise().id);
+            }
+        }
+        values.resize(points.size());
+        try {
+            if constexpr (wantsSolves) {
+                evaluate(std::span<const std::size_t>(solves), std::span<const double>(points), std::span<Value>(values));
+            } else {
+                evaluate(std::span<const double>(points), std::span<Value>(values));
+            }
+        } catch (...) {
+            // The solves keep waiting for these points; the next tick asks for them again
+            pending.insert(pending.begin(), waiting.begin(), waiting.end());
+            waiting.clear();
+            throw;
+        }
+        tickCount++;
+        evaluationCount += points.size();
+
+        std::size_t offset = 0;
+        for (const Request& request : waiting) {
+            std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(offset), request.count, request.values);
+            offset += request.count;
+        }
+        for (const Request& request : waiting) {
+            resume(request.handle);
+        }
+        return finish_tick();
+    }
+
+    // Ticks until every spawned solve has finished.
+    template <typename Evaluate>
+    void run(Evaluate&& evaluate) {
+        while (tick(evaluate) > 0) {
+        }
+    }
+
+    std::size_t in_flight() const { return inFlight; }
+
+    // Results of the finished solves, indexed by the value spawn() returned; default-constructed
+    // for solves still in flight.
+    const std::vector<SolveResult>& results() const { return solveResults; }
+
+    // Calls of the batch evaluator so far, and the points they evaluated.
+    std::size_t ticks() const { return tickCount; }
+    std::size_t evaluations() const { return evaluationCount; }
+
+private:
+    struct Request {
+        SolveTask::Handle handle;
+        const double* points;
+        Value* values;
+        std::size_t count;
+    };
+
+    void enqueue(SolveTask::Handle handle, const double* requestPoints, Value* requestValues, std::size_t count) {
+        pending.push_back({handle, requestPoints, requestValues, count});
+    }
+
+    // Runs a solve up to its next evaluation, and collects its result when it finishes instead.
+    void resume(SolveTask::Handle handle) {
+        handle.resume();
+        if (!handle.done()) {
+            return;
+        }
+        SolveTask::promise_type& promise = handle.promise();
+        solveResults[promise.id] = promise.result;
+        if (promise.error && !solveError) {
+            solveError = promise.error;
+        }
+        handle.destroy();
+        inFlight--;
+    }
+
+    std::size_t finish_tick() {
+        if (solveError) {
+            std::rethrow_exception(std::exchange(solveError, nullptr));
+        }
+        return inFlight;
+    }
+
+    std::vector<SolveTask::Handle> starting;
+    std::vector<Request> pending;
+    std::vector<Request> waiting;
+    std::vector<double> points;
+    std::vector<std::size_t> solves;
+    std::vector<Value> values;
+    std::vector<SolveResult> solveResults;
+    std::exception_ptr solveError;
+    std::size_t inFlight = 0;
+    std::size_t tickCount = 0;
+    std::size_t evaluationCount = 0;
+};
+
+/**
+ * @brief Secant method awaiting its evaluations from `scheduler`; the iterates of try_secant_solver().
+ *
+ * @param tolerance The convergence criterion. The algorithm stops when |p_n - p_(n-2)| < tolerance.
+ * @return SolveTask delivering a SolveResult with status `Converged` or `MaxIterationsReached`.
+ */
+inline SolveTask async_secant_solver(EvaluationScheduler<>& scheduler, double p0, double p1, double tolerance = 1e-6,
+                                     int maxIterations = 1000000) {
+    SolveResult result;
+    int i = 2;
+
+    double q0 = co_await scheduler.evaluate(p0);
+    double q1 = co_await scheduler.evaluate(p1);
+    result.evaluations = 2;
+    result.root = p1;
+    result.fRoot = q1;
+
+    while (i <= maxIterations) {
+        double p = p1 - q1 * (p1 - p0) / (q1 - q0);
+        result.iterations = i - 1;
+        result.root = p;
+        if (std::abs(p - p0) < tolerance) {
+            result.status = SolveStatus::Converged;
+            co_return result;
+        }
+        i++;
+
+        p0 = p1;
+        q0 = q1;
+        p1 = p;
+        q1 = co_await scheduler.evaluate(p);
+        result.evaluations++;
+        result.fRoot = q1;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    co_return result;
+}
+
+/**
+ * @brief False position method awaiting its evaluations from `scheduler`; the iterates of
+ *        try_false_position_solver().
+ *
+ * @param tolerance The convergence criterion. The algorithm stops when |p_n - p_(n-1)| < tolerance.
+ * @return SolveTask delivering a SolveResult with status `Converged`, `InvalidBracket` or `MaxIterationsReached`.
+ */
+inline SolveTask async_false_position_solver(EvaluationScheduler<>& scheduler, double p0, double p1,
+                                             double tolerance = 1e-6, int maxIterations = 1000000) {
+    SolveResult result;
+    int i = 2;
+
+    // Both end points in one round-trip
+    const double ends[2] = {p0, p1};
+    double fEnds[2];
+    co_await scheduler.evaluate(ends, fEnds);
+    double q0 = fEnds[0];
+    double q1 = fEnds[1];
+    result.evaluations = 2;
+    result.root = p1;
+    result.fRoot = q1;
+
+    if (q0 * q1 > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        co_return result;
+    }
+
+    while (i <= maxIterations) {
+        double p = p1 - q1 * (p1 - p0) / (q1 - q0);
+        result.iterations = i - 1;
+        result.root = p;
+        if (std::abs(p - p1) < tolerance) {
+            result.status = SolveStatus::Converged;
+            co_return result;
+        }
+
+        double q = co_await scheduler.evaluate(p);
+        result.evaluations++;
+        result.fRoot = q;
+        if (q * q1 < 0) {
+            p0 = p1;
+            q0 = q1;
+        }
+        p1 = p;
+        q1 = q;
+        i++;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    co_return result;
+}
+
+/**
+ * @brief Brent's method awaiting its evaluations from `scheduler`; the iterates of try_brent_solver().
+ *
+ * @param tolerance The method stops when the bracket is narrower than 2·tolerance.
+ * @return SolveTask delivering a SolveResult with status `Converged`, `InvalidBracket` or `MaxIterationsReached`.
+ */
+inline SolveTask async_brent_solver(EvaluationScheduler<>& scheduler, double leftBound, double rightBound,
+                                    double tolerance = 1e-6, int maxIterations = 1000000) {
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+    SolveResult result;
+    double a = leftBound;
+    double b = rightBound;
+    const double ends[2] = {a, b};
+    double fEnds[2];
+    co_await scheduler.evaluate(ends, fEnds);
+    double fa = fEnds[0];
+    double fb = fEnds[1];
+    result.evaluations = 2;
+    result.root = b;
+    result.fRoot = fb;
+
+    if (fa * fb > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        co_return result;
+    }
+
+    double c = b, fc = fb;
+    double d = b - a, e = d;
+    for (int i = 1; ; i++) {
+        if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+        if (std::abs(fc) < std::abs(fb)) {
+            a = b; b = c; c = a;
+            fa = fb; fb = fc; fc = fa;
+        }
+        result.root = b;
+        result.fRoot = fb;
+
+        // Against the half-width, so the bracket ends narrower than 2·tolerance plus rounding
+        double tol = 2 * eps * std::abs(b) + tolerance;
+        double xm = 0.5 * (c - b);
+        if (std::abs(xm) <= tol || fb == 0) {
+            result.status = SolveStatus::Converged;
+            co_return result;
+        }
+        if (i > maxIterations) {
+            break;
+        }
+
+        if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+            double p, q;
+            double s = fb / fa;
+            if (a == c) {
+                p = 2 * xm * s;
+                q = 1 - s;
+            } else {
+                double r = fb / fc;
+                q = fa / fc;
+                p = s * (2 * xm * q * (q - r) - (b - a) * (r - 1));
+                q = (q - 1) * (r - 1) * (s - 1);
+            }
+            if (p > 0) {
+                q = -q;
+            }
+            p = std::abs(p);
+            if (2 * p < std::min(3 * xm * q - std::abs(tol * q), std::abs(e * q))) {
+                e = d;
+                d = p / q;
+            } else {
+                d = xm;
+                e = d;
+            }
+        } else {
+            d = xm;
+            e = d;
+        }
+
+        a = b;
+        fa = fb;
+        b += std::abs(d) > tol ? d : (xm > 0 ? tol : -tol);
+        fb = co_await scheduler.evaluate(b);
+        result.evaluations++;
+        result.iterations = i;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    co_return result;
+}
+
+/**
+ * @brief Newton-Raphson method awaiting its evaluations from `scheduler`.
+ *
+ * With an EvaluationScheduler<ValueAndDerivative> every iteration awaits one evaluation of f and f'.
+ * With an EvaluationScheduler<double> it awaits f at x and x ± h in the same tick and takes the
+ * central difference, with the step cbrt(eps)·max(|x|, 1) balancing truncation against rounding.
+ *
+ * @param tolerance The convergence criterion. The algorithm stops when |p - p0| < tolerance.
+ * @return SolveTask delivering a SolveResult with status `Converged`, `ZeroDerivative` or `MaxIterationsReached`.
+ */
+template <typename Value>
+SolveTask async_newton_raphson_solver(EvaluationScheduler<Value>& scheduler, double p0, double tolerance = 1e-6,
+                                      int maxIterations = 1000000) {
+    static_assert(std::is_same_v<Value, double> || std::is_same_v<Value, ValueAndDerivative>,
+                  "async_newton_raphson_solver() needs a scheduler evaluating double or ValueAndDerivative.");
+    SolveResult result;
+    result.root = p0;
+
+    for (int i = 1; i <= maxIterations; i++) {
+        double fp, fPrimeP0;
+        if constexpr (std::is_same_v<Value, ValueAndDerivative>) {
+            ValueAndDerivative y = co_await scheduler.evaluate(p0);
+            fp = y.value;
+            fPrimeP0 = y.derivative;
+            result.evaluations++;
+        } else {
+            const double h = detail::scaled_step(p0, std::cbrt(std::numeric_limits<double>::epsilon()));
+            const double stencil[3] = {p0, p0 + h, p0 - h};
+            double y[3];
+            co_await scheduler.evaluate(stencil, y);
+            fp = y[0];
+            fPrimeP0 = (y[1] - y[2]) / (2 * h);
+            result.evaluations += 3;
+        }
+        result.fRoot = fp;
+
+        if (fPrimeP0 == 0) {
+            result.status = SolveStatus::ZeroDerivative;
+            co_return result;
+        }
+
+        double p = p0 - fp / fPrimeP0;
+        result.iterations = i;
+        result.root = p;
+        if (std::abs(p - p0) < tolerance) {
+            result.status = SolveStatus::Converged;
+            co_return result;
+        }
+        p0 = p;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    co_return result;
+}
+
+#endif //ASYNC_SOLVERS_H
@@ -0,0 +1,117 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "auto-solver.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// Never destroyed, like the metrics registry the classes read from
+struct ProblemClassRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ProblemClass>> classes;
+};
+
+ProblemClassRegistry& problem_class_registry() {
+    static ProblemClassRegistry* registry = new ProblemClassRegistry;
+    return *registry;
+}
+
+} // namespace
+
+ProblemClass::ProblemClass(std::string_view name) : className(name) {
+    for (std::size_t m = 0; m < autoMethodCount; m++) {
+        metrics[m] = &solver_metrics(className + "/" + auto_method_name(static_cast<AutoMethod>(m)));
+        costs[m].store(std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+    }
+    refresh();
+}
+
+AutoMethod ProblemClass::choose(const ProblemProbe& probe) {
+    const std::uint64_t solve = solves.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (solve % autoRefreshInterval == 0) {
+        refresh();
+    }
+
+    const AutoMethod suggested = heuristic_auto_method(probe);
+    bool warm = true;
+    for (std::size_t m = 0; m < autoMethodCount; m++) {
+        if (auto_method_allowed(static_cast<AutoMethod>(m), probe) && samples(static_cast<AutoMethod>(m)) < autoMinSamples) {
+            warm = false;
+        }
+    }
+
+    const std::uint64_t interval = warm ? autoExploreInterval : autoWarmupExploreInterval;
+    if (solve % interval == 0) {
+        // The allowed method with the fewest solves; ties go round, since the counts are only
+        // re-read every autoRefreshInterval solves
+        const std::size_t first = static_cast<std::size_t>(solve / interval % autoMethodCount);
+        AutoMethod explored = suggested;
+        std::uint64_t fewest = std::numeric_limits<std::uint64_t>::max();
+        for (std::size_t k = 0; k < autoMethodCount; k++) {
+            auto method = static_cast<AutoMethod>((first + k) % autoMethodCount);
+            if (auto_method_allowed(method, probe) && samples(method) < fewest) {
+                explored = method;
+                fewest = samples(method);
+            }
+        }
+        return explored;
+    }
+
+    // The suggestion until it has been measured, then whatever measured cheaper
+    AutoMethod best = suggested;
+    double bestCost = learned_cost(suggested);
+    if (!std::isfinite(bestCost) && samples(suggested) < autoMinSamples) {
+        return suggested;
+    }
+    for (std::size_t m = 0; m < autoMethodCount; m++) {
+        auto method = static_cast<AutoMethod>(m);
+        if (auto_method_allowed(method, probe) && learned_cost(method) < bestCost) {
+            best = method;
+            bestCost = learned_cost(method);
+        }
+    }
+    return best;
+}
+
+void ProblemClass::record(AutoMethod method, const SolveResult& result, std::uint64_t functionTicks,
+                          std::uint64_t totalTicks) {
+    metrics[static_cast<std::size_t>(method)]->record(result, functionTicks, totalTicks);
+}
+
+double ProblemClass::learned_cost(AutoMethod method) const {
+    return costs[static_cast<std::size_t>(method)].load(std::memory_order_relaxed);
+}
+
+std::uint64_t ProblemClass::samples(AutoMethod method) const {
+    return sampleCounts[static_cast<std::size_t>(method)].load(std::memory_order_relaxed);
+}
+
+void ProblemClass::refresh() {
+    for (std::size_t m = 0; m < autoMethodCount; m++) {
+        SolverMetricsSnapshot snapshot = metrics[m]->snapshot();
+        const std::uint64_t converged = snapshot.solves - snapshot.failures();
+        double cost = std::numeric_limits<double>::infinity();
+        if (snapshot.solves >= autoMinSamples && converged > 0) {
+            cost = static_cast<double>(snapshot.evaluations) / static_cast<double>(converged);
+        }
+        sampleCounts[m].store(snapshot.solves, std::memory_order_relaxed);
+        costs[m].store(cost, std::memory_order_relaxed);
+    }
+}
+
+ProblemClass& problem_class(std::string_view name) {
+    ProblemClassRegistry& registry = problem_class_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& cls : registry.classes) {
+        if (cls->name() == name) {
+            return *cls;
+        }
+    }
+    registry.classes.push_back(std::make_unique<ProblemClass>(name));
+    return *registry.classes.back();
+}
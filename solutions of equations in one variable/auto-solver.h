@@ -0,0 +1,353 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef AUTO_SOLVER_H
+#define AUTO_SOLVER_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "accelerated-solvers.h"
+#include "bracketing-solvers.h"
+#include "cycle-clock.h"
+#include "dual.h"
+#include "equations-solver.h"
+#include "higher-order-solvers.h"
+#include "memoized-objective.h"
+#include "solve-result.h"
+#include "solver-metrics.h"
+#include "taylor-jet.h"
+
+// Automatic method selection: solve(problem) probes the problem, picks a method and runs it, so call
+// sites do not have to choose between the solvers by hand.
+//
+// The probes cost up to five evaluations of f: the two bounds, if given, to see whether they bracket
+// a root, and f, f' and f'' at the starting point (one evaluation on a Taylor jet when f is generic,
+// three for central differences otherwise), whose curvature ratio |f·f''| / f'² measures how far
+// off the linear model of a Newton step is. From those the dispatcher takes, in this order:
+//
+//   bracket, f or its derivatives not finite at the start   bisection, the only method not relying on them
+//   bracket, exact derivatives, curvature ratio < 1         safeguarded Newton, one dual evaluation per step
+//   bracket otherwise                                       Brent
+//   no bracket, f' = 0 or not finite                        Steffensen, which needs no derivative
+//   no bracket, differences only, curvature ratio < 0.1     Steffensen on x - f(x)/f'(x0), nearly linear
+//   no bracket otherwise                                    Halley
+//
+// A problem that names a ProblemClass also learns. Every solve of the class is counted in the
+// metrics registry (solver-metrics.h) under "<class>/<method>", enabled or not (timed only while
+// metering is enabled), and the class re-reads those counters every autoRefreshInterval solves.
+// Once a method has autoMinSamples solves in the class, its cost — evaluations of f over all its
+// solves divided by those that converged, so failures count against it — is compared with that of
+// the other methods the probes allow, and the cheapest one is used. Every
+// autoWarmupExploreInterval-th solve (autoExploreInterval-th once every allowed method has its
+// samples) tries the allowed method with the fewest solves instead, so a class finds the best
+// method for the workload it actually sees and follows it when that changes.
+//
+// If the chosen method fails on a bracketed problem, solve() falls back to Brent's method. An open
+// method converging to a root outside the bracket has failed too: its solve is counted with status
+// `OutsideBracket`, so the class learns against it, and Brent's method solves the bracket.
+
+// The methods solve() dispatches to, in the order of their metrics names.
+enum class AutoMethod {
+    Bisection,          // try_bisection_solver() on the bracket
+    Brent,              // try_brent_solver() on the bracket
+    SafeguardedNewton,  // try_safeguarded_newton_solver() on the bracket
+    Steffensen,         // try_steffensen_solver() on x - f(x)/f'(x0) from the starting point
+    Halley,             // try_halley_solver() from the starting point
+};
+
+inline constexpr std::size_t autoMethodCount = static_cast<std::size_t>(AutoMethod::Halley) + 1;
+
+// Solves of a method in a class before its learned cost is trusted.
+inline constexpr std::uint64_t autoMinSamples = 16;
+// Solves of a class between two reads of its counters from the metrics registry.
+inline constexpr std::uint64_t autoRefreshInterval = 32;
+// Every n-th solve of a class explores while one of the allowed methods lacks samples, and after.
+inline constexpr std::uint64_t autoWarmupExploreInterval = 4;
+inline constexpr std::uint64_t autoExploreInterval = 64;
+
+inline const char* auto_method_name(AutoMethod method) {
+    switch (method) {
+        case AutoMethod::Bisection: return "bisection";
+        case AutoMethod::Brent: return "brent";
+        case AutoMethod::SafeguardedNewton: return "safeguarded_newton";
+        case AutoMethod::Steffensen: return "steffensen";
+        case AutoMethod::Halley: return "halley";
+    }
+    return "unknown";
+}
+
+// What the probes of solve() found out about a problem.
+struct ProblemProbe {
+    bool bracket = false;           // f(leftBound) and f(rightBound) do not have the same sign
+    double fLeft = 0, fRight = 0;   // if bounds were given
+    double x0 = 0;                  // the starting point of the open methods and of the probes
+    double fx0 = 0;
+    double derivative = 0;          // f'(x0), f''(x0): exact for generic f, central differences otherwise
+    double secondDerivative = 0;
+    double curvatureRatio = std::numeric_limits<double>::infinity();  // |f·f''| / f'² at x0
+    bool exactDerivatives = false;  // f is generic, so derivatives come from one evaluation
+    int evaluations = 0;            // spent on the probes
+
+    bool finite() const { return std::isfinite(fx0) && std::isfinite(derivative) && std::isfinite(secondDerivative); }
+    bool has_slope() const { return finite() && derivative != 0; }
+};
+
+// Whether the probes allow `method` at all: the bracketing methods need a bracket, the open ones a
+// usable slope at the starting point.
+inline bool auto_method_allowed(AutoMethod method, const ProblemProbe& probe) {
+    switch (method) {
+        case AutoMethod::Bisection:
+        case AutoMethod::Brent:
+        case AutoMethod::SafeguardedNewton:
+            return probe.bracket;
+        case AutoMethod::Steffensen:
+        case AutoMethod::Halley:
+            return probe.has_slope() || !probe.bracket;
+    }
+    return false;
+}
+
+// The method the probes suggest, see the top of this file.
+inline AutoMethod heuristic_auto_method(const ProblemProbe& probe) {
+    if (probe.bracket) {
+        if (!probe.finite()) {
+            return AutoMethod::Bisection;
+        }
+        if (probe.has_slope() && probe.exactDerivatives && probe.curvatureRatio < 1) {
+            return AutoMethod::SafeguardedNewton;
+        }
+        return AutoMethod::Brent;
+    }
+    if (!probe.has_slope() || (!probe.exactDerivatives && probe.curvatureRatio < 0.1)) {
+        return AutoMethod::Steffensen;
+    }
+    return AutoMethod::Halley;
+}
+
+/**
+ * @brief A family of problems that solve() learns the best method for, obtained from problem_class().
+ *
+ * Thread-safe: solves of one class may run on any number of threads.
+ */
+class ProblemClass {
+public:
+    explicit ProblemClass(std::string_view name);
+
+    const std::string& name() const { return className; }
+
+    // The method for the next solve with this probe (see the top of auto-solver.h).
+    AutoMethod choose(const ProblemProbe& probe);
+
+    // Counts a solve of `method`, as metered_solve() does.
+    void record(AutoMethod method, const SolveResult& result, std::uint64_t functionTicks, std::uint64_t totalTicks);
+
+    // Evaluations per converged solve of `method` as of the last read of the counters; infinity
+    // while the method has fewer than autoMinSamples solves.
+    double learned_cost(AutoMethod method) const;
+    // Solves of `method` as of the last read of the counters.
+    std::uint64_t samples(AutoMethod method) const;
+
+private:
+    void refresh();
+
+    std::string className;
+    std::array<SolverMetrics*, autoMethodCount> metrics{};
+    std::atomic<std::uint64_t> solves = 0;
+    std::array<std::atomic<double>, autoMethodCount> costs{};
+    std::array<std::atomic<std::uint64_t>, autoMethodCount> sampleCounts{};
+};
+
+/**
+ * @brief The problem class called `name`, registered on first use.
+ *
+ * Registration takes a lock and registers one metrics handle per method; keep the reference.
+ *
+ * @throws std::length_error If the metrics registry is full.
+ */
+ProblemClass& problem_class(std::string_view name);
+
+/**
+ * @brief A root-finding problem for solve(): the objective and what is known about its root.
+ *
+ * Give a bracket, a starting point or both; a missing one is NaN. Without a starting point the
+ * probes start from the secant point of the bracket.
+ *
+ *     auto r = solve(RootProblem{.f = f, .leftBound = 1, .rightBound = 2, .problemClass = &cubics});
+ */
+template <typename F>
+struct RootProblem {
+    F f;
+    double leftBound = std::numeric_limits<double>::quiet_NaN();
+    double rightBound = std::numeric_limits<double>::quiet_NaN();
+    double initialGuess = std::numeric_limits<double>::quiet_NaN();
+    double tolerance = 1e-10;
+    int maxIterations = 1000;
+    ProblemClass* problemClass = nullptr;   // learns across solves when set
+};
+
+// Outcome of solve().
+struct AutoSolveResult {
+    SolveResult result;         // of the method that ran last; evaluations include the probes
+    AutoMethod method{};        // that method
+    ProblemProbe probe;
+    bool fellBack = false;      // the chosen method failed and Brent's method solved the bracket
+};
+
+namespace detail {
+
+template <typename F>
+ProblemProbe probe_problem(F& f, const RootProblem<F>& problem) {
+    ProblemProbe probe;
+    const bool bounds = std::isfinite(problem.leftBound) && std::isfinite(problem.rightBound)
+                        && problem.leftBound != problem.rightBound;
+    if (bounds) {
+        probe.fLeft = f(problem.leftBound);
+        probe.fRight = f(problem.rightBound);
+        probe.evaluations += 2;
+        probe.bracket = !(probe.fLeft * probe.fRight > 0);
+    }
+    if (std::isfinite(problem.initialGuess)) {
+        probe.x0 = problem.initialGuess;
+    } else if (probe.bracket && probe.fLeft != probe.fRight) {
+        probe.x0 = problem.rightBound - probe.fRight * (problem.rightBound - problem.leftBound) / (probe.fRight - probe.fLeft);
+    } else if (bounds) {
+        probe.x0 = problem.leftBound + (problem.rightBound - problem.leftBound) / 2;
+    } else {
+        throw std::invalid_argument("A problem needs a bracket or an initial guess.");
+    }
+
+    probe.exactDerivatives = JetDifferentiable<F, 2>;
+    Jet<double, 2> jet = taylor_coefficients<2>(f, probe.x0, probe.evaluations);
+    probe.fx0 = jet.value();
+    probe.derivative = jet.derivative(1);
+    probe.secondDerivative = jet.derivative(2);
+    if (probe.derivative != 0) {
+        probe.curvatureRatio = std::abs(probe.fx0 * probe.secondDerivative) / (probe.derivative * probe.derivative);
+    }
+    return probe;
+}
+
+// `OutsideBracket` for a root of an open method outside the bracket of the problem, if it has one
+template <typename F>
+SolveResult within_bracket(SolveResult result, const RootProblem<F>& problem, const ProblemProbe& probe) {
+    const double lo = std::min(problem.leftBound, problem.rightBound);
+    const double hi = std::max(problem.leftBound, problem.rightBound);
+    if (probe.bracket && result.converged() && !(result.root >= lo && result.root <= hi)) {
+        result.status = SolveStatus::OutsideBracket;
+    }
+    return result;
+}
+
+// Runs `method` on g, the objective or its metered wrapper
+template <typename G, typename F>
+SolveResult run_auto_method(AutoMethod method, G& g, const RootProblem<F>& problem, const ProblemProbe& probe) {
+    const double a = problem.leftBound, b = problem.rightBound;
+    switch (method) {
+        case AutoMethod::Bisection: {
+            SolveResult result = try_bisection_solver(a, b, KnownEndpoints<G>{g, a, probe.fLeft, b, probe.fRight},
+                                                      problem.tolerance, problem.maxIterations);
+            result.evaluations -= 2;
+            return result;
+        }
+        case AutoMethod::Brent: {
+            SolveResult result = try_brent_solver(a, b, KnownEndpoints<G>{g, a, probe.fLeft, b, probe.fRight},
+                                                  problem.tolerance, problem.maxIterations);
+            result.evaluations -= 2;
+            return result;
+        }
+        case AutoMethod::SafeguardedNewton: {
+            SolveResult result = try_safeguarded_newton_solver(a, b, KnownEndpoints<G>{g, a, probe.fLeft, b, probe.fRight},
+                                                               problem.tolerance, problem.maxIterations);
+            result.evaluations -= 2;
+            return result;
+        }
+        case AutoMethod::Steffensen: {
+            // The fixed point of x - f(x)/f'(x0), contracting near a simple root close to x0
+            const double slope = probe.has_slope() ? probe.derivative : 1;
+            SolveResult result = try_steffensen_solver(probe.x0, [&g, slope](double x) { return x - g(x) / slope; },
+                                                       problem.tolerance, problem.maxIterations);
+            result.fRoot *= -slope;  // g(x) - x = -f(x)/slope
+            return within_bracket(result, problem, probe);
+        }
+        case AutoMethod::Halley:
+            return within_bracket(try_halley_solver(probe.x0, g, problem.tolerance, problem.maxIterations), problem,
+                                  probe);
+    }
+    return {};
+}
+
+// run_auto_method(), counted in the class of the problem if it has one. The class only needs the
+// counts; the objective is timed, at a few ns per evaluation, only while metering is enabled.
+template <typename F>
+SolveResult run_counted_auto_method(AutoMethod method, F& f, const RootProblem<F>& problem, const ProblemProbe& probe) {
+    if (problem.problemClass == nullptr) {
+        return run_auto_method(method, f, problem, probe);
+    }
+    if (!metrics_enabled()) {
+        SolveResult result = run_auto_method(method, f, problem, probe);
+        problem.problemClass->record(method, result, 0, 0);
+        return result;
+    }
+    std::uint64_t start = cycle_clock_ticks();
+    MeteredFunction<F> metered(f);
+    SolveResult result = run_auto_method(method, metered, problem, probe);
+    problem.problemClass->record(method, result, metered.function_ticks(), cycle_clock_ticks() - start);
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Finds a root of `problem.f` with a method chosen from cheap probes and, for problems of a
+ *        ProblemClass, from what earlier solves of the class cost.
+ *
+ * See the top of this file for the probes, the dispatch rules and the learning.
+ *
+ * @param problem The objective, a bracket and/or a starting point, the tolerance and iteration
+ *        limit passed to the method, and optionally the class to learn in.
+ * @return AutoSolveResult with the result, the method that produced it and the probes.
+ * @throws std::invalid_argument If the problem has neither a bracket nor an initial guess.
+ */
+template <typename F>
+AutoSolveResult solve(RootProblem<F> problem) {
+    F& f = problem.f;
+    AutoSolveResult out;
+    out.probe = detail::probe_problem(f, problem);
+    const ProblemProbe& probe = out.probe;
+
+    // A probe that hit a root ends the solve
+    double exact[3][2] = {{probe.x0, probe.fx0}, {problem.leftBound, probe.fLeft}, {problem.rightBound, probe.fRight}};
+    for (int k = 0; k < (probe.bracket ? 3 : 1); k++) {
+        if (exact[k][1] == 0) {
+            out.method = heuristic_auto_method(probe);
+            out.result.root = exact[k][0];
+            out.result.evaluations = probe.evaluations;
+            out.result.status = SolveStatus::Converged;
+            return out;
+        }
+    }
+
+    out.method = problem.problemClass != nullptr ? problem.problemClass->choose(probe) : heuristic_auto_method(probe);
+    out.result = detail::run_counted_auto_method(out.method, f, problem, probe);
+    int evaluations = probe.evaluations + out.result.evaluations;
+    if (!out.result.converged() && probe.bracket && out.method != AutoMethod::Brent) {
+        out.method = AutoMethod::Brent;
+        out.fellBack = true;
+        out.result = detail::run_counted_auto_method(AutoMethod::Brent, f, problem, probe);
+        evaluations += out.result.evaluations;
+    }
+    out.result.evaluations = evaluations;
+    return out;
+}
+
+#endif //AUTO_SOLVER_H
@@ -0,0 +1,204 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef BATCH_DRIVER_H
+#define BATCH_DRIVER_H
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "batch-solvers.h"
+#include "solver-workspace.h"
+#include "work-stealing-pool.h"
+
+// Multithreaded driver for the batch engine: splits a batch into chunks and solves them on a
+// WorkStealingPool, so threads that drew fast-converging problems take over the work of slower ones.
+//
+// Every chunk is solved by the single-threaded batch solver into its lane-local arrays and stored
+// once per block. Chunks are a multiple of 64 problems, so two threads only ever write to the same
+// cache line of an output array at a chunk boundary of an unaligned span. Per-thread counters live
+// in cache-line padded slots.
+//
+// The overloads taking a SolverWorkspace and a BatchReport take the counters from the workspace and
+// refill the report in place, so repeated solves on the same thread do not allocate.
+
+// Outcome of a parallel batch solve.
+struct BatchReport {
+    std::size_t converged = 0;          // problems that converged
+    std::vector<WorkerStats> workers;   // what every thread of the pool did, for checking scaling
+};
+
+// Default number of problems per chunk handed to a thread.
+inline constexpr std::size_t batchChunkSize = 1024;
+
+namespace detail {
+
+struct alignas(64) PaddedCount {
+    std::size_t value = 0;
+};
+
+inline BatchResults slice_results(const BatchResults& results, std::size_t begin, std::size_t end) {
+    return {results.roots.subspan(begin, end - begin), results.status.subspan(begin, end - begin),
+            results.iterations.empty() ? std::span<int>() : results.iterations.subspan(begin, end - begin)};
+}
+
+// What run_parallel_batch() takes from a workspace
+inline std::size_t batch_workspace_size(const WorkStealingPool& pool) {
+    return pool.thread_count() * sizeof(PaddedCount);
+}
+
+// Runs `solveChunk(begin, end)` over [0, count) on the pool into `report`; it returns the number of
+// converged problems.
+template <typename SolveChunk>
+const BatchReport& run_parallel_batch(WorkStealingPool& pool, SolverWorkspace& workspace, std::size_t count,
+                                      std::size_t chunkSize, BatchReport& report, SolveChunk&& solveChunk) {
+    SolverWorkspace::Scope scope(workspace);
+    chunkSize = (chunkSize + 63) / 64 * 64;
+    std::span<PaddedCount> converged = workspace.allocate_array<PaddedCount>(pool.thread_count());
+    pool.parallel_for(count, chunkSize, [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        converged[worker].value += solveChunk(begin, end);
+    });
+
+    report.converged = 0;
+    for (const PaddedCount& slot : converged) {
+        report.converged += slot.value;
+    }
+    pool.last_run_stats(report.workers);
+    return report;
+}
+
+} // namespace detail
+
+/**
+ * @brief batch_bisection_solver() spread over the threads of `pool`, allocation-free.
+ *
+ * Takes the per-thread counters from `workspace` and refills `report`, reusing its storage.
+ *
+ * @param chunkSize The number of problems handed to a thread at a time, rounded up to a multiple of 64.
+ * @return `report`, with the number of converged problems and the per-thread statistics.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F>
+const BatchReport& parallel_batch_bisection_solver(WorkStealingPool& pool, SolverWorkspace& workspace,
+                                                   std::span<const double> leftBounds,
+                                                   std::span<const double> rightBounds, F&& f,
+                                                   const BatchResults& results, BatchReport& report,
+                                                   double tolerance = 1e-6, int maxIterations = 1000000,
+                                                   std::size_t chunkSize = batchChunkSize) {
+    detail::check_batch_sizes(leftBounds.size(), rightBounds.size(), results);
+    return detail::run_parallel_batch(pool, workspace, leftBounds.size(), chunkSize, report,
+                                      [&](std::size_t begin, std::size_t end) {
+        return batch_bisection_solver(leftBounds.subspan(begin, end - begin), rightBounds.subspan(begin, end - begin),
+                                      [&f, begin](std::size_t i, auto x) -> decltype(f(begin + i, x)) { return f(begin + i, x); },
+                                      detail::slice_results(results, begin, end), tolerance, maxIterations);
+    });
+}
+
+/**
+ * @brief batch_bisection_solver() spread over the threads of `pool`.
+ *
+ * @param chunkSize The number of problems handed to a thread at a time, rounded up to a multiple of 64.
+ * @return BatchReport with the number of converged problems and the per-thread statistics.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F>
+BatchReport parallel_batch_bisection_solver(WorkStealingPool& pool, std::span<const double> leftBounds,
+                                            std::span<const double> rightBounds, F&& f, const BatchResults& results,
+                                            double tolerance = 1e-6, int maxIterations = 1000000,
+                                            std::size_t chunkSize = batchChunkSize) {
+    SolverWorkspace workspace(detail::batch_workspace_size(pool));
+    BatchReport report;
+    parallel_batch_bisection_solver(pool, workspace, leftBounds, rightBounds, std::forward<F>(f), results, report,
+                                    tolerance, maxIterations, chunkSize);
+    return report;
+}
+
+/**
+ * @brief batch_false_position_solver() spread over the threads of `pool`, allocation-free.
+ *
+ * Takes the per-thread counters from `workspace` and refills `report`, reusing its storage.
+ *
+ * @param chunkSize The number of problems handed to a thread at a time, rounded up to a multiple of 64.
+ * @return `report`, with the number of converged problems and the per-thread statistics.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F>
+const BatchReport& parallel_batch_false_position_solver(WorkStealingPool& pool, SolverWorkspace& workspace,
+                                                        std::span<const double> p0, std::span<const double> p1, F&& f,
+                                                        const BatchResults& results, BatchReport& report,
+                                                        double tolerance = 1e-6, int maxIterations = 1000000,
+                                                        std::size_t chunkSize = batchChunkSize) {
+    detail::check_batch_sizes(p0.size(), p1.size(), results);
+    return detail::run_parallel_batch(pool, workspace, p0.size(), chunkSize, report,
+                                      [&](std::size_t begin, std::size_t end) {
+        return batch_false_position_solver(p0.subspan(begin, end - begin), p1.subspan(begin, end - begin),
+                                           [&f, begin](std::size_t i, auto x) -> decltype(f(begin + i, x)) { return f(begin + i, x); },
+                                           detail::slice_results(results, begin, end), tolerance, maxIterations);
+    });
+}
+
+/**
+ * @brief batch_false_position_solver() spread over the threads of `pool`.
+ *
+ * @param chunkSize The number of problems handed to a thread at a time, rounded up to a multiple of 64.
+ * @return BatchReport with the number of converged problems and the per-thread statistics.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F>
+BatchReport parallel_batch_false_position_solver(WorkStealingPool& pool, std::span<const double> p0,
+                                                 std::span<const double> p1, F&& f, const BatchResults& results,
+                                                 double tolerance = 1e-6, int maxIterations = 1000000,
+                                                 std::size_t chunkSize = batchChunkSize) {
+    SolverWorkspace workspace(detail::batch_workspace_size(pool));
+    BatchReport report;
+    parallel_batch_false_position_solver(pool, workspace, p0, p1, std::forward<F>(f), results, report, tolerance,
+                                         maxIterations, chunkSize);
+    return report;
+}
+
+/**
+ * @brief batch_newton_raphson_solver() spread over the threads of `pool`, allocation-free.
+ *
+ * Takes the per-thread counters from `workspace` and refills `report`, reusing its storage.
+ *
+ * @param chunkSize The number of problems handed to a thread at a time, rounded up to a multiple of 64.
+ * @return `report`, with the number of converged problems and the per-thread statistics.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F>
+const BatchReport& parallel_batch_newton_raphson_solver(WorkStealingPool& pool, SolverWorkspace& workspace,
+                                                        std::span<const double> initialPoints, F&& f,
+                                                        const BatchResults& results, BatchReport& report,
+                                                        double tolerance = 1e-6, int maxIterations = 1000000,
+                                                        std::size_t chunkSize = batchChunkSize) {
+    detail::check_batch_sizes(initialPoints.size(), initialPoints.size(), results);
+    return detail::run_parallel_batch(pool, workspace, initialPoints.size(), chunkSize, report,
+                                      [&](std::size_t begin, std::size_t end) {
+        return batch_newton_raphson_solver(initialPoints.subspan(begin, end - begin),
+                                           [&f, begin](std::size_t i, auto x) -> decltype(f(begin + i, x)) { return f(begin + i, x); },
+                                           detail::slice_results(results, begin, end), tolerance, maxIterations);
+    });
+}
+
+/**
+ * @brief batch_newton_raphson_solver() spread over the threads of `pool`.
+ *
+ * @param chunkSize The number of problems handed to a thread at a time, rounded up to a multiple of 64.
+ * @return BatchReport with the number of converged problems and the per-thread statistics.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F>
+BatchReport parallel_batch_newton_raphson_solver(WorkStealingPool& pool, std::span<const double> initialPoints, F&& f,
+                                                 const BatchResults& results, double tolerance = 1e-6,
+                                                 int maxIterations = 1000000, std::size_t chunkSize = batchChunkSize) {
+    SolverWorkspace workspace(detail::batch_workspace_size(pool));
+    BatchReport report;
+    parallel_batch_newton_raphson_solver(pool, workspace, initialPoints, std::forward<F>(f), results, report,
+                                         tolerance, maxIterations, chunkSize);
+    return report;
+}
+
+#endif //BATCH_DRIVER_H
@@ -0,0 +1,607 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef BRACKETING_SOLVERS_H
+#define BRACKETING_SOLVERS_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "derivative-policies.h"
+#include "equations-solver.h"
+#include "solve-result.h"
+#include "solver-error.h"
+#include "solver-observers.h"
+#include "stopping-criteria.h"
+
+// Hybrid bracketing methods. Like bisection_solver() they start from an interval [leftBound, rightBound]
+// on which f changes sign and never let the root escape the bracket, but they interpolate where the
+// function is well behaved and so converge superlinearly instead of linearly.
+//
+// Unlike bisection_solver(), whose tolerance applies to |f(p)|, these methods stop once the
+// bracket around the root is narrower than 2·tolerance (or f vanishes at an iterate), which bounds
+// the error of the root itself. Every iteration costs exactly one evaluation of f.
+//
+// The iteration table has the columns Iteration, a, b (the current bracket), p (the new iterate)
+// and f(p).
+
+namespace detail {
+
+inline bool same_sign(double x, double y) {
+    return (x > 0) == (y > 0);
+}
+
+inline void report_bracket(int i, double x, double y, double p, double fp, auto& observer) {
+    observer.on_iteration(i, {x < y ? x : y, x < y ? y : x, p, fp});
+}
+
+} // namespace detail
+
+// A bracket whose end values are already known, from a table or an earlier probe, so a solver
+// started on it does not evaluate f there again.
+struct KnownBracket {
+    double left, fLeft;
+    double right, fRight;
+};
+
+/**
+ * @brief Finds the root of a function using Brent's method, without throwing.
+ *
+ * Brent's method (zeroin) keeps a bracket [b, c] with the best iterate b, and takes an inverse
+ * quadratic interpolation or secant step from the last three points when that step lands well
+ * inside the bracket and shrinks it fast enough; otherwise it bisects. It therefore converges
+ * superlinearly on smooth functions and needs at most about (log2((b - a) / tolerance))² evaluations
+ * in the worst case.
+ *
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable for which the root is being sought.
+ * @param tolerance The method stops when the bracket is narrower than 2·tolerance.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if `f(leftBound)` and `f(rightBound)`
+ *         do not have opposite signs, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_brent_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                             int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+    SolveResult result;
+    double a = leftBound;
+    double b = rightBound;
+    double fa = f(a);
+    double fb = f(b);
+    result.evaluations = 2;
+    result.root = b;
+    result.fRoot = fb;
+
+    if (fa * fb > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+
+    detail::start_table(observer, "brent", {{"Iteration", 10}, {"a", 15}, {"b", 15}, {"p", 15}, {"f(p)", 15}});
+
+    double c = b, fc = fb;
+    double d = b - a, e = d;
+    for (int i = 1; ; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+            // b and c on the same side: the root is between a and b, restart the bracket there
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+        if (std::abs(fc) < std::abs(fb)) {
+            // Keep the best iterate in b
+            a = b; b = c; c = a;
+            fa = fb; fb = fc; fc = fa;
+        }
+        result.root = b;
+        result.fRoot = fb;
+
+        // Against the half-width, so the bracket ends narrower than 2·tolerance plus rounding
+        double tol = 2 * eps * std::abs(b) + tolerance;
+        double xm = 0.5 * (c - b);
+        if (std::abs(xm) <= tol || fb == 0) {
+            observer.on_converged(b);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        if (i > maxIterations) {
+            break;
+        }
+
+        if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+            double p, q;
+            double s = fb / fa;
+            if (a == c) {
+                // Secant step
+                p = 2 * xm * s;
+                q = 1 - s;
+            } else {
+                // Inverse quadratic interpolation
+                double r = fb / fc;
+                q = fa / fc;
+                p = s * (2 * xm * q * (q - r) - (b - a) * (r - 1));
+                q = (q - 1) * (r - 1) * (s - 1);
+            }
+            if (p > 0) {
+                q = -q;
+            }
+            p = std::abs(p);
+            // Accept the interpolation only if it stays inside the bracket and shrinks the step
+            if (2 * p < std::min(3 * xm * q - std::abs(tol * q), std::abs(e * q))) {
+                e = d;
+                d = p / q;
+            } else {
+                d = xm;
+                e = d;
+            }
+        } else {
+            d = xm;
+            e = d;
+        }
+
+        a = b;
+        fa = fb;
+        b += std::abs(d) > tol ? d : (xm > 0 ? tol : -tol);
+        fb = f(b);
+        result.evaluations++;
+        result.iterations = i;
+        detail::report_bracket(i, b, detail::same_sign(fb, fc) ? a : c, b, fb, observer);
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using Brent's method.
+ *
+ * Throwing form of try_brent_solver().
+ *
+ * @return double The approximate root of the function `f` within the given interval.
+ * @throws std::invalid_argument If `f(leftBound)` and `f(rightBound)` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to find a root within the given number of iterations.
+ */
+template <typename F, typename Observer = NullObserver>
+double brent_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                    Observer&& observer = Observer{}) {
+    SolveResult result = try_brent_solver(leftBound, rightBound, std::forward<F>(f), tolerance, maxIterations,
+                                          std::forward<Observer>(observer));
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+    }
+    return result.root;
+}
+
+/**
+ * @brief Finds the root of a function using Chandrupatla's method from a bracket with known end values,
+ *        without throwing.
+ *
+ * try_chandrupatla_solver() below without the evaluations at the two ends, which `evaluations` does not count.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_chandrupatla_solver(const KnownBracket& bracket, F&& f, double tolerance = 1e-6,
+                                    int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+    SolveResult result;
+    double b = bracket.left;
+    double a = bracket.right;
+    double fb = bracket.fLeft;
+    double fa = bracket.fRight;
+    result.root = std::abs(fa) < std::abs(fb) ? a : b;
+    result.fRoot = std::abs(fa) < std::abs(fb) ? fa : fb;
+
+    if (fa * fb > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+    if (fa == 0 || fb == 0) {
+        result.status = SolveStatus::Converged;
+        return result;
+    }
+
+    detail::start_table(observer, "chandrupatla", {{"Iteration", 10}, {"a", 15}, {"b", 15}, {"p", 15}, {"f(p)", 15}});
+
+    double c = a, fc = fa;
+    double t = 0.5;
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        double xt = a + t * (b - a);
+        double ft = f(xt);
+        result.evaluations++;
+        result.iterations = i;
+
+        if (detail::same_sign(ft, fa)) {
+            c = a;
+            fc = fa;
+        } else {
+            c = b;
+            fc = fb;
+            b = a;
+            fb = fa;
+        }
+        a = xt;
+        fa = ft;
+        detail::report_bracket(i, a, b, xt, ft, observer);
+
+        double xm = std::abs(fa) < std::abs(fb) ? a : b;
+        double fm = std::abs(fa) < std::abs(fb) ? fa : fb;
+        result.root = xm;
+        result.fRoot = fm;
+
+        double tol = 2 * eps * std::abs(xm) + tolerance;
+        double tlim = tol / std::abs(b - a);
+        if (fm == 0 || tlim > 0.5) {
+            observer.on_converged(xm);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+
+        double xi = (a - b) / (c - b);
+        double phi = (fa - fb) / (fc - fb);
+        if (phi * phi < xi && (1 - phi) * (1 - phi) < 1 - xi) {
+            // Inverse quadratic interpolation through (a, fa), (b, fb), (c, fc)
+            t = fa / (fb - fa) * fc / (fb - fc) + (c - a) / (b - a) * fa / (fc - fa) * fb / (fc - fb);
+        } else {
+            t = 0.5;
+        }
+        // Never step closer than the tolerance to an end point
+        t = std::min(1 - tlim, std::max(tlim, t));
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using Chandrupatla's method, without throwing.
+ *
+ * Chandrupatla's method keeps the bracket [a, b] plus the previous end point c, and places the next
+ * iterate at a + t·(b - a). It uses inverse quadratic interpolation for t only when the last three
+ * points indicate that the function is smooth enough for it (Chandrupatla's criterion
+ * phi² < xi and (1 - phi)² < 1 - xi), and bisects otherwise. Compared with Brent's method the
+ * test is simpler and it avoids the slow steps Brent takes near a root of higher multiplicity.
+ *
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable for which the root is being sought.
+ * @param tolerance The method stops when the bracket is narrower than 2·tolerance.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if `f(leftBound)` and `f(rightBound)`
+ *         do not have opposite signs, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_chandrupatla_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                                    int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    KnownBracket bracket{leftBound, f(leftBound), rightBound, f(rightBound)};
+    SolveResult result = try_chandrupatla_solver(bracket, f, tolerance, maxIterations, std::forward<Observer>(observer));
+    result.evaluations += 2;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using Chandrupatla's method.
+ *
+ * Throwing form of try_chandrupatla_solver().
+ *
+ * @return double The approximate root of the function `f` within the given interval.
+ * @throws std::invalid_argument If `f(leftBound)` and `f(rightBound)` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to find a root within the given number of iterations.
+ */
+template <typename F, typename Observer = NullObserver>
+double chandrupatla_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                           int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    SolveResult result = try_chandrupatla_solver(leftBound, rightBound, std::forward<F>(f), tolerance, maxIterations,
+                                                 std::forward<Observer>(observer));
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+    }
+    return result.root;
+}
+
+/**
+ * @brief Finds the root of a function using the ITP (Interpolate, Truncate, Project) method, without throwing.
+ *
+ * ITP (Oliveira and Takahashi, 2020) computes a regula falsi point, truncates it towards the
+ * midpoint by k1·(b - a)^k2 and projects it into a ball around the midpoint whose radius shrinks
+ * so that the method never needs more than n_{1/2} + n0 iterations, where
+ * n_{1/2} = ceil(log2((b - a) / (2·tolerance))) is what bisection needs. On smooth functions it
+ * converges superlinearly like the secant method. The parameters are k1 = 0.2 / (b - a), k2 = 2 and
+ * n0 = 1.
+ *
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable for which the root is being sought.
+ * @param tolerance The method stops when the bracket is narrower than 2·tolerance; raised to half the
+ *        spacing of doubles at the larger bound if it is below that, 0 included.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if `f(leftBound)` and `f(rightBound)`
+ *         do not have opposite signs, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_itp_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                           int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    SolveResult result;
+    double a = std::min(leftBound, rightBound);
+    double b = std::max(leftBound, rightBound);
+    double ya = f(a);
+    double yb = f(b);
+    result.evaluations = 2;
+    result.root = std::abs(ya) < std::abs(yb) ? a : b;
+    result.fRoot = std::abs(ya) < std::abs(yb) ? ya : yb;
+
+    if (ya * yb > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+    if (ya == 0 || yb == 0) {
+        result.status = SolveStatus::Converged;
+        return result;
+    }
+
+    detail::start_table(observer, "itp", {{"Iteration", 10}, {"a", 15}, {"b", 15}, {"p", 15}, {"f(p)", 15}});
+
+    // Work with sign * f so that it increases from a to b
+    const double sign = ya < 0 ? 1.0 : -1.0;
+    ya *= sign;
+    yb *= sign;
+
+    const double k1 = 0.2 / (b - a);
+    const double k2 = 2;
+    const int n0 = 1;
+    // A tolerance below the spacing of doubles in the bracket cannot be met, and 0 (which a
+    // StoppingCriteria with both x tolerances disabled passes) would make n_{1/2} infinite
+    tolerance = std::max(tolerance, std::max(std::numeric_limits<double>::epsilon() / 2 * std::max(std::abs(a), std::abs(b)),
+                                             std::numeric_limits<double>::denorm_min()));
+    const int nHalf = b > a ? static_cast<int>(std::ceil(std::log2((b - a) / (2 * tolerance)))) : 0;
+    const int nMax = std::max(nHalf, 0) + n0;
+
+    for (int j = 0; b - a > 2 * tolerance; j++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        if (j >= maxIterations) {
+            result.status = SolveStatus::MaxIterationsReached;
+            return result;
+        }
+        // Interpolate
+        double xHalf = 0.5 * (a + b);
+        double xf = (yb * a - ya * b) / (yb - ya);
+        // Truncate
+        double sigma = xHalf - xf > 0 ? 1.0 : (xHalf - xf < 0 ? -1.0 : 0.0);
+        double delta = k1 * std::pow(b - a, k2);
+        double xt = delta <= std::abs(xHalf - xf) ? xf + sigma * delta : xHalf;
+        // Project
+        double r = tolerance * std::ldexp(1.0, nMax - j) - 0.5 * (b - a);
+        double x = std::abs(xt - xHalf) <= r ? xt : xHalf - sigma * r;
+
+        double fx = f(x);
+        double y = sign * fx;
+        result.evaluations++;
+        result.iterations = j + 1;
+        result.root = x;
+        result.fRoot = fx;
+        detail::report_bracket(j + 1, a, b, x, fx, observer);
+
+        if (y > 0) {
+            b = x;
+            yb = y;
+        } else if (y < 0) {
+            a = x;
+            ya = y;
+        } else {
+            a = b = x;
+        }
+    }
+    result.root = 0.5 * (a + b);
+    observer.on_converged(result.root);
+    result.status = SolveStatus::Converged;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using the ITP method.
+ *
+ * Throwing form of try_itp_solver().
+ *
+ * @return double The approximate root of the function `f` within the given interval.
+ * @throws std::invalid_argument If `f(leftBound)` and `f(rightBound)` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to find a root within the given number of iterations.
+ */
+template <typename F, typename Observer = NullObserver>
+double itp_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                  Observer&& observer = Observer{}) {
+    SolveResult result = try_itp_solver(leftBound, rightBound, std::forward<F>(f), tolerance, maxIterations,
+                                        std::forward<Observer>(observer));
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+    }
+    return result.root;
+}
+
+/**
+ * @brief Finds the root of a function using Newton's method safeguarded by bisection, without throwing.
+ *
+ * Bracketed Newton in the style of rtsafe: the method keeps the bisection bracket [a, b] and takes
+ * the Newton step from the current iterate whenever it stays inside the bracket and at least halves
+ * the step before the last one; otherwise it bisects. It converges quadratically near a simple root,
+ * while a vanishing derivative, divergence or cycling only fall back to bisection, so the cost is
+ * never worse than bisection's. The bracket is updated exactly like in bisection_solver() and the
+ * derivative comes from a derivative policy as in newton_raphson_solver().
+ *
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable for which the root is being sought.
+ * @param tolerance The method stops when the last step is shorter than tolerance.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param derivative The derivative policy computing f(p) and f'(p) (see derivative-policies.h).
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if `f(leftBound)` and `f(rightBound)`
+ *         do not have opposite signs, or `MaxIterationsReached`.
+ */
+template <typename F, typename Derivative = AutomaticDerivative, typename Observer = NullObserver>
+SolveResult try_safeguarded_newton_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                                          int maxIterations = 1000000, Derivative&& derivative = Derivative{},
+                                          Observer&& observer = Observer{}) {
+    SolveResult result;
+    double a = leftBound;
+    double b = rightBound;
+    double FA = f(a);
+    double FB = f(b);
+    result.evaluations = 2;
+    result.root = std::abs(FA) < std::abs(FB) ? a : b;
+    result.fRoot = std::abs(FA) < std::abs(FB) ? FA : FB;
+
+    if (FA * FB > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+    if (FA == 0 || FB == 0) {
+        result.status = SolveStatus::Converged;
+        return result;
+    }
+
+    detail::start_table(observer, "safeguarded_newton",
+                        {{"Iteration", 10}, {"a", 15}, {"b", 15}, {"p", 15}, {"f(p)", 15}});
+
+    double p = a + (b - a) / 2;
+    double dxOld = std::abs(b - a);
+    double dx = dxOld;
+    ValueAndDerivative y = derivative(f, p);
+    result.evaluations += y.evaluations;
+
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        double FP = y.value;
+        double fPrime = y.derivative;
+        bool newtonLeavesBracket = ((p - b) * fPrime - FP) * ((p - a) * fPrime - FP) > 0;
+        bool newtonTooSlow = std::abs(2 * FP) > std::abs(dxOld * fPrime);
+        dxOld = dx;
+        if (newtonLeavesBracket || newtonTooSlow) {
+            dx = (b - a) / 2;
+            p = a + dx;
+        } else {
+            dx = FP / fPrime;
+            p -= dx;
+        }
+
+        y = derivative(f, p);
+        result.evaluations += y.evaluations;
+        result.iterations = i;
+        result.root = p;
+        result.fRoot = y.value;
+        detail::report_bracket(i, a, b, p, y.value, observer);
+
+        if (std::abs(dx) < tolerance || y.value == 0) {
+            observer.on_converged(p);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        detail::shrink_bracket(a, FA, b, p, y.value);
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using Newton's method safeguarded by bisection.
+ *
+ * Throwing form of try_safeguarded_newton_solver().
+ *
+ * @return double The approximate root of the function `f` within the given interval.
+ * @throws std::invalid_argument If `f(leftBound)` and `f(rightBound)` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to find a root within the given number of iterations.
+ */
+template <typename F, typename Derivative = AutomaticDerivative, typename Observer = NullObserver>
+double safeguarded_newton_solver(double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                                 int maxIterations = 1000000, Derivative&& derivative = Derivative{},
+                                 Observer&& observer = Observer{}) {
+    SolveResult result = try_safeguarded_newton_solver(leftBound, rightBound, std::forward<F>(f), tolerance,
+                                                       maxIterations, std::forward<Derivative>(derivative),
+                                                       std::forward<Observer>(observer));
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+    }
+    return result.root;
+}
+
+// Overloads of the try_ solvers taking a StoppingCriteria instead of (tolerance, maxIterations)
+
+/**
+ * @brief try_brent_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_brent_solver(double leftBound, double rightBound, F&& f, const StoppingCriteria& criteria,
+                             Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(leftBound), std::abs(rightBound)));
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_brent_solver(leftBound, rightBound, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_chandrupatla_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_chandrupatla_solver(double leftBound, double rightBound, F&& f, const StoppingCriteria& criteria,
+                                    Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(leftBound), std::abs(rightBound)));
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_chandrupatla_solver(leftBound, rightBound, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_itp_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_itp_solver(double leftBound, double rightBound, F&& f, const StoppingCriteria& criteria,
+                           Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(leftBound), std::abs(rightBound)));
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_itp_solver(leftBound, rightBound, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_safeguarded_newton_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Derivative = AutomaticDerivative, typename Observer = NullObserver>
+SolveResult try_safeguarded_newton_solver(double leftBound, double rightBound, F&& f, const StoppingCriteria& criteria,
+                                          Derivative&& derivative = Derivative{}, Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(leftBound), std::abs(rightBound)));
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_safeguarded_newton_solver(leftBound, rightBound, objective, tolerance, criteria.maxIterations, derivative, budgetObserver);
+    });
+}
+
+#endif //BRACKETING_SOLVERS_H
@@ -0,0 +1,252 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef CHEBYSHEV_PROXY_H
+#define CHEBYSHEV_PROXY_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bracketing-solvers.h"
+#include "derivative-policies.h"
+#include "solve-result.h"
+#include "solver-error.h"
+
+// Chebyshev proxy for solving f(x) = c for many right-hand sides c on a fixed interval.
+//
+// The expensive f is sampled once at Chebyshev points of [leftBound, rightBound], with the number of
+// points doubled (reusing the previous samples, the point sets nest) until the Chebyshev coefficients
+// have decayed below the requested accuracy. The resulting interpolant is accurate to about
+// accuracy·max|f| over the whole interval and costs one Clenshaw recurrence of its degree to
+// evaluate, together with its derivative.
+//
+// Every solve then runs safeguarded Newton on the proxy and finishes with a single Newton step on
+// the true f (using the proxy's derivative), which removes the interpolation error to first order.
+// A solve therefore costs one evaluation of f instead of the 5-50 of a direct solve.
+
+// Upper limit on the degree of the interpolant; building costs O(degree²) operations.
+inline constexpr std::size_t chebyshevMaxDegree = 4096;
+
+/**
+ * @brief Chebyshev interpolant of f on [leftBound, rightBound] with fast repeated solves of f(x) = c.
+ *
+ *     auto f = [](double x) { return expensive(x); };
+ *     ChebyshevProxy proxy(f, 0.0, 10.0);
+ *     double x = proxy.solve(2.5);          // f(x) = 2.5
+ *
+ * f is stored by value (wrap it in std::ref to keep a reference) and is called again from the const
+ * solve functions, so it must be callable as const.
+ */
+template <typename F>
+class ChebyshevProxy {
+public:
+    /**
+     * @brief Samples f and builds the interpolant.
+     *
+     * @param f The function to approximate.
+     * @param leftBound The left boundary of the interval.
+     * @param rightBound The right boundary of the interval.
+     * @param accuracy Relative accuracy of the interpolant: the tail of the Chebyshev series is below accuracy·max|f|.
+     * @param maxDegree The largest degree tried before giving up.
+     * @throws std::invalid_argument If leftBound is not below rightBound.
+     * @throws std::runtime_error If f is not resolved to the accuracy with degree maxDegree, e.g. because it is not smooth.
+     */
+    ChebyshevProxy(F f, double leftBound, double rightBound, double accuracy = 1e-13,
+                   std::size_t maxDegree = chebyshevMaxDegree)
+        : function(std::move(f)), a(leftBound), b(rightBound) {
+        if (!(leftBound < rightBound)) {
+            throw std::invalid_argument("The interval must satisfy leftBound < rightBound.");
+        }
+        build(accuracy, maxDegree);
+    }
+
+    std::size_t degree() const { return coefficients.size() - 1; }
+
+    // Evaluations of f spent to build the interpolant.
+    std::size_t build_evaluations() const { return buildEvaluations; }
+
+    // Chebyshev coefficients of the interpolant on [leftBound, rightBound], lowest order first.
+    const std::vector<double>& chebyshev_coefficients() const { return coefficients; }
+
+    // The interpolant at x (Clenshaw's recurrence).
+    double operator()(double x) const {
+        return clenshaw(coefficients, to_unit(x));
+    }
+
+    // The interpolant and its derivative at x, counted as one evaluation of the proxy.
+    ValueAndDerivative value_and_derivative(double x) const {
+        double t = to_unit(x);
+        return {clenshaw(coefficients, t), clenshaw(derivativeCoefficients, t), 1};
+    }
+
+    /**
+     * @brief Solves f(x) = c on the interval, without throwing.
+     *
+     * @param c The right-hand side.
+     * @param tolerance Stopping criterion of the solve on the proxy, as in try_safeguarded_newton_solver().
+     * @param maxIterations The maximum number of iterations on the proxy.
+     * @return SolveResult whose root is the polished root, `iterations` counts the proxy iterations and
+     *         `evaluations` the evaluations of the true f (one); fRoot is f - c at the proxy root, before
+     *         the polishing step. Status `InvalidBracket` if f - c does not change sign on the interval
+     *         according to the proxy.
+     */
+    SolveResult try_solve(double c, double tolerance = 1e-12, int maxIterations = 100) const {
+        SolveResult result = try_safeguarded_newton_solver(a, b, Shifted{*this, c}, tolerance, maxIterations);
+        result.evaluations = 0;
+        if (!result.converged()) {
+            return result;
+        }
+
+        double x = result.root;
+        double residual = function(x) - c;
+        double slope = value_and_derivative(x).derivative;
+        result.evaluations = 1;
+        result.fRoot = residual;
+        if (slope != 0) {
+            result.root = std::clamp(x - residual / slope, a, b);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Solves f(x) = c on the interval.
+     *
+     * Throwing form of try_solve().
+     *
+     * @throws std::invalid_argument If f - c does not change sign on the interval.
+     * @throws std::runtime_error If the solve on the proxy does not converge within maxIterations iterations.
+     */
+    double solve(double c, double tolerance = 1e-12, int maxIterations = 100) const {
+        SolveResult result = try_solve(c, tolerance, maxIterations);
+        if (result.status == SolveStatus::InvalidBracket) {
+            throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+        }
+        if (!result.converged()) {
+            throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+        }
+        return result.root;
+    }
+
+private:
+    // The proxy minus c, as an objective providing its own derivative
+    struct Shifted {
+        const ChebyshevProxy& proxy;
+        double c;
+
+        double operator()(double x) const { return proxy(x) - c; }
+        ValueAndDerivative value_and_derivative(double x) const {
+            ValueAndDerivative y = proxy.value_and_derivative(x);
+            y.value -= c;
+            return y;
+        }
+    };
+
+    double to_unit(double x) const { return (2 * x - a - b) / (b - a); }
+
+    static double clenshaw(const std::vector<double>& c, double t) {
+        double b1 = 0, b2 = 0;
+        for (std::size_t k = c.size(); k-- > 1;) {
+            double b0 = std::fma(2 * t, b1, c[k] - b2);
+            b2 = b1;
+            b1 = b0;
+        }
+        return std::fma(t, b1, c[0] - b2);
+    }
+
+    void build(double accuracy, std::size_t maxDegree) {
+        // values[j] = f(x_j) at the Chebyshev points x_j = cos(pi j / n), j = 0 .. n
+        std::size_t n = 16;
+        std::vector<double> values(n + 1);
+        for (std::size_t j = 0; j <= n; j++) {
+            values[j] = function(point(j, n));
+        }
+        buildEvaluations = n + 1;
+
+        while (true) {
+            coefficients = chebyshev_transform(values);
+            double scale = 0;
+            for (double v : values) {
+                scale = std::max(scale, std::abs(v));
+            }
+            double threshold = accuracy * std::max(scale, std::numeric_limits<double>::min());
+            bool resolved = true;
+            for (std::size_t k = n - 3; k <= n; k++) {
+                resolved = resolved && std::abs(coefficients[k]) <= threshold;
+            }
+            if (resolved) {
+                // Drop the tail while what is dropped stays below the threshold
+                double dropped = 0;
+                while (coefficients.size() > 1 && dropped + std::abs(coefficients.back()) <= threshold) {
+                    dropped += std::abs(coefficients.back());
+                    coefficients.pop_back();
+                }
+                break;
+            }
+            if (2 * n > maxDegree) {
+                throw std::runtime_error("Chebyshev interpolant not resolved to the requested accuracy with degree "
+                                         + std::to_string(n) + ".");
+            }
+
+            std::vector<double> finer(2 * n + 1);
+            for (std::size_t j = 0; j <= 2 * n; j++) {
+                finer[j] = j % 2 == 0 ? values[j / 2] : function(point(j, 2 * n));
+            }
+            buildEvaluations += n;
+            values = std::move(finer);
+            n *= 2;
+        }
+
+        // Derivative coefficients: d_(k-1) = d_(k+1) + 2k c_k, halved for k - 1 = 0, scaled to [a, b]
+        std::size_t m = coefficients.size();
+        derivativeCoefficients.assign(std::max<std::size_t>(m - 1, 1), 0.0);
+        for (std::size_t k = m - 1; k >= 1; k--) {
+            double next = k + 1 < m - 1 ? derivativeCoefficients[k + 1] : 0.0;
+            derivativeCoefficients[k - 1] = next + 2 * static_cast<double>(k) * coefficients[k];
+        }
+        derivativeCoefficients[0] /= 2;
+        for (double& d : derivativeCoefficients) {
+            d *= 2 / (b - a);
+        }
+    }
+
+    double point(std::size_t j, std::size_t n) const {
+        double t = std::cos(std::numbers::pi * static_cast<double>(j) / static_cast<double>(n));
+        return (a + b) / 2 + (b - a) / 2 * t;
+    }
+
+    // Chebyshev coefficients from the values at the n + 1 points cos(pi j / n) (a type-I DCT).
+    static std::vector<double> chebyshev_transform(const std::vector<double>& values) {
+        std::size_t n = values.size() - 1;
+        std::vector<double> cosines(2 * n);
+        for (std::size_t i = 0; i < 2 * n; i++) {
+            cosines[i] = std::cos(std::numbers::pi * static_cast<double>(i) / static_cast<double>(n));
+        }
+        std::vector<double> c(n + 1);
+        for (std::size_t k = 0; k <= n; k++) {
+            double sum = (values[0] + (k % 2 == 0 ? values[n] : -values[n])) / 2;
+            for (std::size_t j = 1; j < n; j++) {
+                sum += values[j] * cosines[j * k % (2 * n)];
+            }
+            c[k] = sum * 2 / static_cast<double>(n);
+        }
+        c[0] /= 2;
+        c[n] /= 2;
+        return c;
+    }
+
+    F function;
+    double a, b;
+    std::vector<double> coefficients;
+    std::vector<double> derivativeCoefficients;
+    std::size_t buildEvaluations = 0;
+};
+
+#endif //CHEBYSHEV_PROXY_H
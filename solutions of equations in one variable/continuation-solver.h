@@ -0,0 +1,163 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef CONTINUATION_SOLVER_H
+#define CONTINUATION_SOLVER_H
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "batch-solvers.h"
+#include "derivative-policies.h"
+#include "dual.h"
+#include "equations-solver.h"
+#include "solve-result.h"
+
+// Continuation driver for parameter sweeps: solves f(x; θ_k) = 0 for a sequence θ_0, θ_1, ... of
+// closely spaced parameters, seeding every solve with a prediction from the roots already found
+// instead of a fixed starting point. With a good predictor the corrector starts within a fraction
+// of the step of the new root and needs only 1-2 iterations.
+//
+// The objective is called as `f(x, theta)`. Written generically (`[](auto x, auto theta) { ... }`)
+// it can be evaluated on dual numbers, which gives exact derivatives to the Newton corrector and
+// the tangent predictor.
+
+// How the starting point of the next solve is predicted.
+enum class ContinuationPredictor {
+    Previous,   // the previous root
+    Linear,     // linear extrapolation through the last two roots
+    Quadratic,  // quadratic extrapolation through the last three roots
+    Tangent,    // x + Δθ·dx/dθ with dx/dθ = -f_θ / f_x, from dual numbers (Linear when f does not support them)
+};
+
+// Which solver corrects the prediction.
+enum class ContinuationCorrector {
+    NewtonRaphson,  // try_newton_raphson_solver() from the prediction
+    Secant,         // try_secant_solver() from the previous root and the prediction
+};
+
+// Totals of a continuation sweep.
+struct ContinuationReport {
+    std::size_t converged = 0;  // parameters at which the solve converged
+    long iterations = 0;        // corrector iterations over the sweep
+    long evaluations = 0;       // evaluations of f over the sweep, predictor included
+};
+
+namespace detail {
+
+// True when f can be evaluated with dual numbers in both arguments.
+template <typename F>
+concept DualDifferentiableInBoth = requires(F& f, Dual<double> x) {
+    { f(x, x) } -> std::same_as<Dual<double>>;
+};
+
+// Lagrange extrapolation to `theta` through the `count` most recent points (t[0], x[0]) ... (oldest last).
+inline double extrapolate(const double (&t)[3], const double (&x)[3], int count, double theta) {
+    double value = 0;
+    for (int i = 0; i < count; i++) {
+        double weight = 1;
+        for (int j = 0; j < count; j++) {
+            if (j != i) {
+                weight *= (theta - t[j]) / (t[i] - t[j]);
+            }
+        }
+        value += weight * x[i];
+    }
+    return value;
+}
+
+} // namespace detail
+
+/**
+ * @brief Solves f(x, parameters[k]) = 0 for every k, seeding each solve from the previous roots.
+ *
+ * The first solve starts from `initialGuess`. Every following one starts from the prediction of
+ * `predictor`, which uses only roots that converged: after a failed step the sweep continues from
+ * the last converged root, with as many history points as have converged since.
+ *
+ * @param parameters The parameter values θ_k, in sweep order.
+ * @param initialGuess The starting point of the solve at parameters[0].
+ * @param f The objective, called as `f(x, theta)`.
+ * @param results Where roots, statuses and (optionally) corrector iteration counts are stored.
+ * @param predictor How to predict the next root (see ContinuationPredictor).
+ * @param corrector Which solver refines the prediction (see ContinuationCorrector).
+ * @param tolerance The convergence criterion of the corrector.
+ * @param maxIterations The maximum number of corrector iterations per parameter.
+ * @param derivative The derivative policy of the Newton corrector (see derivative-policies.h).
+ * @return ContinuationReport with the number of converged solves and the iteration and evaluation totals.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <typename F, typename Derivative = AutomaticDerivative>
+ContinuationReport continuation_solver(std::span<const double> parameters, double initialGuess, F&& f,
+                                       const BatchResults& results,
+                                       ContinuationPredictor predictor = ContinuationPredictor::Quadratic,
+                                       ContinuationCorrector corrector = ContinuationCorrector::NewtonRaphson,
+                                       double tolerance = 1e-6, int maxIterations = 1000000,
+                                       Derivative&& derivative = Derivative{}) {
+    detail::check_batch_sizes(parameters.size(), parameters.size(), results);
+
+    ContinuationReport report;
+    // The last converged roots, most recent first
+    double historyTheta[3] = {}, historyX[3] = {};
+    int history = 0;
+
+    for (std::size_t k = 0; k < parameters.size(); k++) {
+        double theta = parameters[k];
+        double previous = history > 0 ? historyX[0] : initialGuess;
+        double seed = previous;
+        if (history > 0) {
+            if (predictor == ContinuationPredictor::Tangent) {
+                if constexpr (detail::DualDifferentiableInBoth<F>) {
+                    double fTheta = f(Dual<double>(historyX[0]), Dual<double>::variable(historyTheta[0])).derivative;
+                    double fX = f(Dual<double>::variable(historyX[0]), Dual<double>(historyTheta[0])).derivative;
+                    report.evaluations += 2;
+                    if (fX != 0) {
+                        seed = historyX[0] - (theta - historyTheta[0]) * fTheta / fX;
+                    }
+                } else {
+                    seed = detail::extrapolate(historyTheta, historyX, history < 2 ? history : 2, theta);
+                }
+            } else if (predictor == ContinuationPredictor::Linear) {
+                seed = detail::extrapolate(historyTheta, historyX, history < 2 ? history : 2, theta);
+            } else if (predictor == ContinuationPredictor::Quadratic) {
+                seed = detail::extrapolate(historyTheta, historyX, history, theta);
+            }
+        }
+
+        // f at this parameter, generic over x when f is, so the derivative policy can use dual numbers
+        auto atTheta = [&f, theta]<typename X>(X x) -> decltype(f(x, theta)) { return f(x, theta); };
+        SolveResult result;
+        if (corrector == ContinuationCorrector::NewtonRaphson) {
+            result = try_newton_raphson_solver(seed, atTheta, tolerance, maxIterations, derivative);
+        } else {
+            double other = previous != seed ? previous : seed + detail::scaled_step(seed, 1e-4);
+            result = try_secant_solver(other, seed, atTheta, tolerance, maxIterations);
+        }
+
+        results.roots[k] = result.root;
+        results.status[k] = result.status;
+        if (!results.iterations.empty()) {
+            results.iterations[k] = result.iterations;
+        }
+        report.iterations += result.iterations;
+        report.evaluations += result.evaluations;
+        if (result.converged()) {
+            report.converged++;
+            for (int i = 2; i > 0; i--) {
+                historyTheta[i] = historyTheta[i - 1];
+                historyX[i] = historyX[i - 1];
+            }
+            historyTheta[0] = theta;
+            historyX[0] = result.root;
+            history = history < 3 ? history + 1 : 3;
+        } else if (history > 0) {
+            history = 1;
+        }
+    }
+    return report;
+}
+
+#endif //CONTINUATION_SOLVER_H
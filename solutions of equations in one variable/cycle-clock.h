@@ -0,0 +1,56 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef CYCLE_CLOCK_H
+#define CYCLE_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Cheapest monotonic clock of the platform, for timestamps taken on the hot path of the solvers
+// (iteration-trace.h, solver-metrics.h): the time-stamp counter on x86, at well under half the cost
+// of steady_clock::now(), and steady_clock nanoseconds elsewhere. Ticks are converted to time with
+// a TickCalibration.
+inline std::uint64_t cycle_clock_ticks() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Measures the length of a cycle_clock_ticks() tick against steady_clock.
+ *
+ * The reference point is taken at construction; nanoseconds_per_tick() measures over at least a
+ * millisecond since then, so the ratio is accurate to a few ppm.
+ */
+class TickCalibration {
+public:
+    double nanoseconds_per_tick() const {
+        std::chrono::steady_clock::time_point now;
+        std::uint64_t ticks;
+        do {
+            now = std::chrono::steady_clock::now();
+            ticks = cycle_clock_ticks();
+        } while (now - startTime < std::chrono::milliseconds(1));
+        if (ticks <= startTicks) {
+            return 1;
+        }
+        return std::chrono::duration<double, std::nano>(now - startTime).count() / static_cast<double>(ticks - startTicks);
+    }
+
+private:
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::uint64_t startTicks = cycle_clock_ticks();
+};
+
+#endif //CYCLE_CLOCK_H
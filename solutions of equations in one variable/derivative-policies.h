@@ -0,0 +1,161 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef DERIVATIVE_POLICIES_H
+#define DERIVATIVE_POLICIES_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "dual.h"
+
+// Derivative policies tell a Newton-type solver how to obtain f'(x). A policy is called as
+// `policy(f, x)` and returns f(x), f'(x) and the number of evaluations of f it spent, so the
+// value needed for the step is always computed together with (and reused by) the derivative.
+//
+//   AutomaticDerivative     f.value_and_derivative(x) or dual numbers when f supports them (1 evaluation),
+//                           else the legacy central difference
+//   AnalyticDerivative      a user-supplied f' (1 evaluation of f plus one of f')
+//   ForwardDifference       (f(x + h) - f(x)) / h reusing f(x) (2 evaluations)
+//   CentralDifference       (f(x + h) - f(x - h)) / 2h with a step scaled to x (3 evaluations)
+//   ComplexStep             Im f(x + ih) / h, exact to rounding for analytic f (1 complex evaluation)
+
+template <typename T>
+struct BasicValueAndDerivative {
+    T value = 0;
+    T derivative = 0;
+    int evaluations = 0;
+};
+
+using ValueAndDerivative = BasicValueAndDerivative<double>;
+
+/**
+ * @brief Calculates the numerical derivative of a function at a given point using the central difference method.
+ *
+ * This function calculates the numerical derivative of a function `f` at a point `x` using the central difference method.
+ * It approximates the derivative by evaluating the function at points slightly offset from `x` by a small step size `h`.
+ *
+ * @param f The callable whose derivative is being computed.
+ * @param x The point at which the derivative is calculated.
+ * @param h The step size used in the central difference formula (default is `1e-10`).
+ * @return double The approximate derivative of `f` at `x`.
+ */
+template <typename F>
+double numerical_derivative(F&& f, double x, double h = 1e-10) {
+    //Using central difference
+    return (f(x + h) - f(x - h)) / (2 * h);
+}
+
+namespace detail {
+
+// Step for a finite difference at x: relativeStep scaled to the magnitude of x (at least 1, so the
+// step does not vanish at x = 0).
+inline double scaled_step(double x, double relativeStep) {
+    return relativeStep * std::max(std::abs(x), 1.0);
+}
+
+} // namespace detail
+
+// True when f evaluates its own derivative along with its value, as Polynomial does with one
+// Horner pass.
+template <typename F>
+concept ValueDerivativeEvaluable = requires(F& f, double x) {
+    { f.value_and_derivative(x) } -> std::same_as<ValueAndDerivative>;
+};
+
+// Default policy: f.value_and_derivative(x) when f provides it, otherwise the exact derivative from
+// one dual-number evaluation when f is generic over its argument type, otherwise f(x) plus
+// numerical_derivative() with its fixed step of 1e-10.
+struct AutomaticDerivative {
+    template <typename F>
+    constexpr ValueAndDerivative operator()(F&& f, double x) const {
+        if constexpr (ValueDerivativeEvaluable<F>) {
+            return f.value_and_derivative(x);
+        } else if constexpr (DualDifferentiable<F>) {
+            Dual<double> y = f(Dual<double>::variable(x));
+            return {y.value, y.derivative, 1};
+        } else {
+            return {f(x), numerical_derivative(f, x), 3};
+        }
+    }
+
+    // Solvers iterating in another scalar type T (float, DoubleDouble): one evaluation on Dual<T>
+    // when f is generic, otherwise a central difference with the step eps^(1/3)·max(|x|, 1) of T.
+    template <typename F, typename T>
+    requires (!std::same_as<T, double>)
+    constexpr BasicValueAndDerivative<T> operator()(F&& f, T x) const {
+        if constexpr (DualDifferentiable<F, T>) {
+            Dual<T> y = f(Dual<T>::variable(x));
+            return {y.value, y.derivative, 1};
+        } else {
+            using std::abs;
+            T scale = abs(x) > T(1) ? abs(x) : T(1);
+            T h = T(std::cbrt(static_cast<double>(std::numeric_limits<T>::epsilon()))) * scale;
+            return {T(f(x)), T((f(x + h) - f(x - h)) / (2 * h)), 3};
+        }
+    }
+};
+
+// User-supplied derivative, called as `derivative(x)` with x of the solver's scalar type.
+template <typename FPrime>
+struct AnalyticDerivative {
+    FPrime derivative;
+
+    template <typename F, typename T>
+    BasicValueAndDerivative<T> operator()(F&& f, T x) {
+        return {T(f(x)), T(derivative(x)), 1};
+    }
+};
+
+template <typename FPrime>
+AnalyticDerivative<std::decay_t<FPrime>> analytic_derivative(FPrime&& derivative) {
+    return {std::forward<FPrime>(derivative)};
+}
+
+// One-sided difference reusing f(x); the default step sqrt(eps)·max(|x|, 1) balances truncation
+// against rounding error.
+struct ForwardDifference {
+    double relativeStep = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    template <typename F>
+    ValueAndDerivative operator()(F&& f, double x) const {
+        double h = detail::scaled_step(x, relativeStep);
+        double xh = x + h;
+        h = xh - x;  // the step actually taken, so the rounding of x + h does not enter the quotient
+        double fx = f(x);
+        return {fx, (f(xh) - fx) / h, 2};
+    }
+};
+
+// Central difference with step relativeStep·max(|x|, 1).
+struct CentralDifference {
+    double relativeStep = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    template <typename F>
+    ValueAndDerivative operator()(F&& f, double x) const {
+        double h = detail::scaled_step(x, relativeStep);
+        return {f(x), (f(x + h) - f(x - h)) / (2 * h), 3};
+    }
+};
+
+// Complex-step derivative: f must accept and return std::complex<double> (e.g. a generic lambda
+// using the std:: math functions). There is no subtraction, so a tiny step gives a derivative
+// exact to rounding, and the real part of the same evaluation is f(x).
+struct ComplexStep {
+    double step = 1e-20;
+
+    template <typename F>
+    requires requires(F& f, std::complex<double> z) { { f(z) } -> std::convertible_to<std::complex<double>>; }
+    ValueAndDerivative operator()(F&& f, double x) const {
+        std::complex<double> y = f(std::complex<double>(x, step));
+        return {y.real(), y.imag() / step, 1};
+    }
+};
+
+#endif //DERIVATIVE_POLICIES_H
@@ -0,0 +1,124 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef DOUBLE_DOUBLE_H
+#define DOUBLE_DOUBLE_H
+
+#include <cmath>
+#include <compare>
+#include <limits>
+
+/**
+ * @brief Double-double number: an unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi)/2.
+ *
+ * About 106 bits of significand (32 decimal digits) at a few times the cost of double arithmetic,
+ * built from the error-free transformations TwoSum and TwoProduct (with fma). The solvers use it to
+ * resolve roots where double evaluation of f is dominated by rounding, e.g. closely spaced roots
+ * of a polynomial given by its coefficients; see mixed-precision-solver.h.
+ *
+ * Only the arithmetic operators, comparisons, abs and sqrt are provided, so objectives evaluated in
+ * double-double have to be built from those (polynomials and rational functions).
+ */
+struct DoubleDouble {
+    double hi = 0;
+    double lo = 0;
+
+    constexpr DoubleDouble() = default;
+    constexpr DoubleDouble(double value) : hi(value) {}
+    constexpr DoubleDouble(double hi, double lo) : hi(hi), lo(lo) {}
+
+    explicit constexpr operator double() const { return hi + lo; }
+
+    // hi + lo of the exact sum of a and b (Knuth's TwoSum)
+    static constexpr DoubleDouble two_sum(double a, double b) {
+        double s = a + b;
+        double v = s - a;
+        return {s, (a - (s - v)) + (b - v)};
+    }
+
+    // Renormalization when |a| >= |b| (Dekker's FastTwoSum)
+    static constexpr DoubleDouble quick_two_sum(double a, double b) {
+        double s = a + b;
+        return {s, b - (s - a)};
+    }
+
+    // hi + lo of the exact product of a and b
+    static DoubleDouble two_product(double a, double b) {
+        double p = a * b;
+        return {p, std::fma(a, b, -p)};
+    }
+
+    friend constexpr DoubleDouble operator+(const DoubleDouble& x) { return x; }
+    friend constexpr DoubleDouble operator-(const DoubleDouble& x) { return {-x.hi, -x.lo}; }
+
+    friend constexpr DoubleDouble operator+(const DoubleDouble& x, const DoubleDouble& y) {
+        DoubleDouble s = two_sum(x.hi, y.hi);
+        DoubleDouble t = two_sum(x.lo, y.lo);
+        s = quick_two_sum(s.hi, s.lo + t.hi);
+        return quick_two_sum(s.hi, s.lo + t.lo);
+    }
+
+    friend constexpr DoubleDouble operator-(const DoubleDouble& x, const DoubleDouble& y) { return x + -y; }
+
+    friend DoubleDouble operator*(const DoubleDouble& x, const DoubleDouble& y) {
+        DoubleDouble p = two_product(x.hi, y.hi);
+        return quick_two_sum(p.hi, p.lo + (x.hi * y.lo + x.lo * y.hi));
+    }
+
+    friend DoubleDouble operator/(const DoubleDouble& x, const DoubleDouble& y) {
+        // Long division: a double quotient, then one correction from the exact remainder
+        double q1 = x.hi / y.hi;
+        DoubleDouble r = x - y * DoubleDouble(q1);
+        double q2 = r.hi / y.hi;
+        r = r - y * DoubleDouble(q2);
+        double q3 = r.hi / y.hi;
+        DoubleDouble q = quick_two_sum(q1, q2);
+        return q + DoubleDouble(q3);
+    }
+
+    DoubleDouble& operator+=(const DoubleDouble& other) { return *this = *this + other; }
+    DoubleDouble& operator-=(const DoubleDouble& other) { return *this = *this - other; }
+    DoubleDouble& operator*=(const DoubleDouble& other) { return *this = *this * other; }
+    DoubleDouble& operator/=(const DoubleDouble& other) { return *this = *this / other; }
+
+    friend constexpr bool operator==(const DoubleDouble& x, const DoubleDouble& y) { return x.hi == y.hi && x.lo == y.lo; }
+    friend constexpr std::partial_ordering operator<=>(const DoubleDouble& x, const DoubleDouble& y) {
+        auto order = x.hi <=> y.hi;
+        return order == 0 ? x.lo <=> y.lo : order;
+    }
+
+    friend constexpr DoubleDouble abs(const DoubleDouble& x) { return x.hi < 0 || (x.hi == 0 && x.lo < 0) ? -x : x; }
+
+    friend DoubleDouble sqrt(const DoubleDouble& x) {
+        if (!(x.hi > 0)) {
+            return DoubleDouble(std::sqrt(x.hi));
+        }
+        // One Newton step on the double root: s + (x - s²) / 2s
+        double s = std::sqrt(x.hi);
+        DoubleDouble residual = x - two_product(s, s);
+        return quick_two_sum(s, residual.hi / (2 * s));
+    }
+};
+
+template <>
+class std::numeric_limits<DoubleDouble> {
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 2 * std::numeric_limits<double>::digits;
+    static constexpr int digits10 = 31;
+
+    static constexpr DoubleDouble epsilon() { return DoubleDouble(0x1p-104); }
+    static constexpr DoubleDouble min() { return DoubleDouble(std::numeric_limits<double>::min()); }
+    static constexpr DoubleDouble max() { return DoubleDouble(std::numeric_limits<double>::max()); }
+    static constexpr DoubleDouble lowest() { return DoubleDouble(std::numeric_limits<double>::lowest()); }
+    static constexpr DoubleDouble infinity() { return DoubleDouble(std::numeric_limits<double>::infinity()); }
+    static constexpr DoubleDouble quiet_NaN() { return DoubleDouble(std::numeric_limits<double>::quiet_NaN()); }
+};
+
+#endif //DOUBLE_DOUBLE_H
@@ -0,0 +1,183 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <cmath>
+#include <concepts>
+#include <type_traits>
+
+/**
+ * @brief Dual number a + b·ε with ε² = 0, for forward-mode automatic differentiation.
+ *
+ * Evaluating an objective at `Dual<T>::variable(x)` yields f(x) in `value` and f'(x) in
+ * `derivative`, exact to rounding, from a single evaluation. An objective is differentiable this
+ * way when it is generic over its argument type and calls the math functions unqualified
+ * (`using std::sqrt; return sqrt(x) - 1;`) so the overloads below are found:
+ *
+ *     auto f = [](auto x) { return x * x * x + 4 * x * x - 10; };
+ *
+ * There is deliberately no conversion from Dual to T: an objective taking `double` is not
+ * mistaken for a differentiable one and the solvers fall back to finite differences.
+ */
+template <typename T>
+struct Dual {
+    T value = 0;
+    T derivative = 0;
+
+    constexpr Dual() = default;
+    constexpr Dual(T value) : value(value) {}
+    constexpr Dual(T value, T derivative) : value(value), derivative(derivative) {}
+
+    // The independent variable x, i.e. x + 1·ε.
+    static constexpr Dual variable(T x) { return {x, T(1)}; }
+
+    constexpr Dual& operator+=(const Dual& other) { return *this = *this + other; }
+    constexpr Dual& operator-=(const Dual& other) { return *this = *this - other; }
+    constexpr Dual& operator*=(const Dual& other) { return *this = *this * other; }
+    constexpr Dual& operator/=(const Dual& other) { return *this = *this / other; }
+
+    friend constexpr Dual operator+(const Dual& x) { return x; }
+    friend constexpr Dual operator-(const Dual& x) { return {-x.value, -x.derivative}; }
+    friend constexpr Dual operator+(const Dual& x, const Dual& y) { return {x.value + y.value, x.derivative + y.derivative}; }
+    friend constexpr Dual operator-(const Dual& x, const Dual& y) { return {x.value - y.value, x.derivative - y.derivative}; }
+    friend constexpr Dual operator*(const Dual& x, const Dual& y) {
+        return {x.value * y.value, x.derivative * y.value + x.value * y.derivative};
+    }
+    friend constexpr Dual operator/(const Dual& x, const Dual& y) {
+        return {x.value / y.value, (x.derivative * y.value - x.value * y.derivative) / (y.value * y.value)};
+    }
+
+    // Comparisons look at the value only, so objectives may branch on their argument
+    friend constexpr bool operator==(const Dual& x, const Dual& y) { return x.value == y.value; }
+    friend constexpr auto operator<=>(const Dual& x, const Dual& y) { return x.value <=> y.value; }
+};
+
+// Mixed arithmetic with plain numbers, e.g. `4 * x` or `x - 10` for x of type Dual<double>
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator+(const Dual<T>& x, S y) { return x + Dual<T>(T(y)); }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator+(S x, const Dual<T>& y) { return Dual<T>(T(x)) + y; }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator-(const Dual<T>& x, S y) { return x - Dual<T>(T(y)); }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator-(S x, const Dual<T>& y) { return Dual<T>(T(x)) - y; }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator*(const Dual<T>& x, S y) { return {x.value * T(y), x.derivative * T(y)}; }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator*(S x, const Dual<T>& y) { return {T(x) * y.value, T(x) * y.derivative}; }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator/(const Dual<T>& x, S y) { return {x.value / T(y), x.derivative / T(y)}; }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr Dual<T> operator/(S x, const Dual<T>& y) { return Dual<T>(T(x)) / y; }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr bool operator==(const Dual<T>& x, S y) { return x.value == T(y); }
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+constexpr auto operator<=>(const Dual<T>& x, S y) { return x.value <=> T(y); }
+
+// Elementary functions, f(a + bε) = f(a) + f'(a)·b·ε
+
+template <typename T>
+Dual<T> sqrt(const Dual<T>& x) {
+    T root = std::sqrt(x.value);
+    return {root, x.derivative / (2 * root)};
+}
+
+template <typename T>
+Dual<T> cbrt(const Dual<T>& x) {
+    T root = std::cbrt(x.value);
+    return {root, x.derivative / (3 * root * root)};
+}
+
+template <typename T>
+Dual<T> exp(const Dual<T>& x) {
+    T e = std::exp(x.value);
+    return {e, e * x.derivative};
+}
+
+template <typename T>
+Dual<T> log(const Dual<T>& x) {
+    return {std::log(x.value), x.derivative / x.value};
+}
+
+template <typename T>
+Dual<T> sin(const Dual<T>& x) {
+    return {std::sin(x.value), std::cos(x.value) * x.derivative};
+}
+
+template <typename T>
+Dual<T> cos(const Dual<T>& x) {
+    return {std::cos(x.value), -std::sin(x.value) * x.derivative};
+}
+
+template <typename T>
+Dual<T> tan(const Dual<T>& x) {
+    T t = std::tan(x.value);
+    return {t, (1 + t * t) * x.derivative};
+}
+
+template <typename T>
+Dual<T> asin(const Dual<T>& x) {
+    return {std::asin(x.value), x.derivative / std::sqrt(1 - x.value * x.value)};
+}
+
+template <typename T>
+Dual<T> acos(const Dual<T>& x) {
+    return {std::acos(x.value), -x.derivative / std::sqrt(1 - x.value * x.value)};
+}
+
+template <typename T>
+Dual<T> atan(const Dual<T>& x) {
+    return {std::atan(x.value), x.derivative / (1 + x.value * x.value)};
+}
+
+template <typename T>
+Dual<T> sinh(const Dual<T>& x) {
+    return {std::sinh(x.value), std::cosh(x.value) * x.derivative};
+}
+
+template <typename T>
+Dual<T> cosh(const Dual<T>& x) {
+    return {std::cosh(x.value), std::sinh(x.value) * x.derivative};
+}
+
+template <typename T>
+Dual<T> tanh(const Dual<T>& x) {
+    T t = std::tanh(x.value);
+    return {t, (1 - t * t) * x.derivative};
+}
+
+template <typename T>
+Dual<T> abs(const Dual<T>& x) {
+    return x.value < 0 ? -x : x;
+}
+
+template <typename T>
+Dual<T> fabs(const Dual<T>& x) {
+    return abs(x);
+}
+
+template <typename T, typename S> requires std::is_arithmetic_v<S>
+Dual<T> pow(const Dual<T>& x, S exponent) {
+    // The value directly: pow(x, e - 1)·x would be inf·0 at x = 0 for 0 < e < 1
+    if (exponent == 0) {
+        return {T(1), T(0)};
+    }
+    return {std::pow(x.value, T(exponent)), T(exponent) * std::pow(x.value, T(exponent) - 1) * x.derivative};
+}
+
+template <typename T>
+Dual<T> pow(const Dual<T>& x, const Dual<T>& exponent) {
+    return exp(exponent * log(x));
+}
+
+// True when `f(Dual<double>)` is well-formed and returns a Dual<double>, i.e. when f can be
+// differentiated by evaluating it on dual numbers.
+template <typename F, typename T = double>
+concept DualDifferentiable = requires(F& f, Dual<T> x) {
+    { f(x) } -> std::same_as<Dual<T>>;
+};
+
+#endif //DUAL_H
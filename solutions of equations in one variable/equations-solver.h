@@ -5,12 +5,585 @@
 #ifndef EQUATIONS_SOLVER_H
 #define EQUATIONS_SOLVER_H
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "derivative-policies.h"
+#include "solve-result.h"
+#include "solver-error.h"
+#include "solver-observers.h"
+#include "stopping-criteria.h"
+
 using namespace std;
 
 //Solve equations using binary search method
-double bisection_solver(double leftBound, double rightBound, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1e6);
-double fixed_point_solver(double initialPoint, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1e6);
-double newton_raphson_solver(double p0, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1e6);
-double secant_solver(double p0, double p1, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1e6);
-double false_position_solver(double p0, double p1, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1e6);
+double bisection_solver(double leftBound, double rightBound, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1000000);
+double fixed_point_solver(double initialPoint, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1000000);
+double newton_raphson_solver(double p0, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1000000);
+double secant_solver(double p0, double p1, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1000000);
+double false_position_solver(double p0, double p1, double (*function)(double), double tolerance = 1e-6, int maxIterations = 1000000);
+
+// Header-only versions of the solvers above. They take any callable object (lambdas with captures,
+// functors holding model parameters, ...) so the objective can be inlined into the iteration loop.
+// The function-pointer overloads above are thin wrappers around these that print the iteration table
+// to std::cout through a TablePrinter; the templates are quiet unless an observer is passed in
+// (see solver-observers.h).
+//
+// Each method comes in two forms: `try_<method>` never throws and reports the outcome in a
+// SolveResult (see solve-result.h), `<method>` returns the bare root and throws on failure.
+//
+// Both forms are generic over the scalar type T of the iteration, double by default. Pass it
+// explicitly to iterate in float or in an extended type such as DoubleDouble (double-double.h),
+// e.g. `try_newton_raphson_solver<DoubleDouble>(x0, f)`; the objective is then called with T and
+// the result is a BasicSolveResult<T>. A T other than double needs `abs` (found by argument-dependent
+// lookup for class types), the arithmetic operators, comparisons and an explicit conversion to
+// double, which is what the observers receive.
+//
+// With an observer that does no I/O (NullObserver, the default) the methods are constexpr, so the
+// root of an equation known at build time can be computed by the compiler. The objective has to be
+// constexpr too; Newton-Raphson then needs it generic for the dual-number derivative, since the
+// finite-difference fallback is not:
+//
+//     constexpr double root = newton_raphson_solver(1.5, [](auto x) { return x * x * x + 4 * x * x - 10; }, 1e-12);
+
+namespace detail {
+
+// |x|, usable in constant expressions for arithmetic T (std::abs is not constexpr before C++23)
+template <typename T>
+constexpr T magnitude(T x) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return x < 0 ? -x : x;
+    } else {
+        using std::abs;
+        return abs(x);
+    }
+}
+
+// Bracket update of the bisection method: replaces the end point of [a, b] that has the same sign
+// as f(p) by p, so the sign change stays inside the bracket.
+template <typename T>
+constexpr void shrink_bracket(T& a, T& FA, T& b, T p, T FP) {
+    if (FA * FP > 0) {
+        a = p;
+        FA = FP;
+    } else {
+        b = p;
+    }
+}
+
+// The root of a try_ result, or the exception the throwing form of the method raises for it. Shared
+// by the throwing templates and the metered function-pointer overloads in equations-solver.cpp.
+template <typename T>
+constexpr T bisection_root(const BasicSolveResult<T>& result, int maxIterations) {
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " iterations.");
+    }
+    return result.root;
+}
+
+// Fixed-point iteration and secant method
+template <typename T>
+constexpr T iteration_root(const BasicSolveResult<T>& result, int maxIterations) {
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " steps.");
+    }
+    return result.root;
+}
+
+template <typename T>
+constexpr T newton_raphson_root(const BasicSolveResult<T>& result, int maxIterations) {
+    if (result.status == SolveStatus::ZeroDerivative) {
+        throw std::invalid_argument("Derivative is zero at the current guess; the algorithm cannot proceed.");
+    }
+    return iteration_root(result, maxIterations);
+}
+
+template <typename T>
+constexpr T false_position_root(const BasicSolveResult<T>& result, int maxIterations) {
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the initial points to have opposite signs.");
+    }
+    return iteration_root(result, maxIterations);
+}
+
+} // namespace detail
+
+/**
+ * @brief Finds the root of a function using the bisection method, without throwing.
+ *
+ * This function implements the bisection method to find the root of a continuous function `f`
+ * within a specified interval [leftBound, rightBound]. It assumes that `f(leftBound)` and `f(rightBound)`
+ * have opposite signs, indicating that a root lies between them.
+ *
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable for which the root is being sought.
+ * @param tolerance The acceptable difference between the function value at the root and zero.
+ *        The method stops if `|f(p)| < tolerance`.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if `f(leftBound)` and `f(rightBound)`
+ *         do not have opposite signs, or `MaxIterationsReached`.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr BasicSolveResult<T> try_bisection_solver(std::type_identity_t<T> leftBound, std::type_identity_t<T> rightBound, F&& f,
+                                                   std::type_identity_t<T> tolerance = 1e-6, int maxIterations = 1000000,
+                                                   Observer&& observer = Observer{}) {
+    BasicSolveResult<T> result;
+    T a = leftBound;
+    T b = rightBound;
+    T FA = f(a);
+    T FB = f(b);
+    result.evaluations = 2;
+
+    if (FA * FB > 0) {
+        result.root = a;
+        result.fRoot = FA;
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+
+    detail::start_table(observer, "bisection", {{"Iteration", 10}, {"a", 15}, {"b", 15}, {"p", 15}, {"f(p)", 15}});
+
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        T p = a + (b - a) / 2;
+        T FP = f(p);
+        result.evaluations++;
+        result.iterations = i;
+        result.root = p;
+        result.fRoot = FP;
+
+        observer.on_iteration(i, {double(a), double(b), double(p), double(FP)});
+
+        if (detail::magnitude(FP) < tolerance) {
+            observer.on_converged(double(p));
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+
+        detail::shrink_bracket(a, FA, b, p, FP);
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using the bisection method.
+ *
+ * Throwing form of try_bisection_solver().
+ *
+ * @return double The approximate root of the function `f` within the given interval.
+ * @throws std::invalid_argument If `f(leftBound)` and `f(rightBound)` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to find a root within the given number of iterations.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr T bisection_solver(std::type_identity_t<T> leftBound, std::type_identity_t<T> rightBound, F&& f,
+                             std::type_identity_t<T> tolerance = 1e-6, int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    return detail::bisection_root(try_bisection_solver<T>(leftBound, rightBound, std::forward<F>(f), tolerance,
+                                                       maxIterations, std::forward<Observer>(observer)), maxIterations);
+}
+
+/**
+ * @brief Finds a fixed point of a function using the fixed-point iteration method, without throwing.
+ *
+ * This function implements the fixed-point iteration method to solve the equation `x = f(x)`.
+ * Starting from an initial guess `p0`, the function iteratively computes `p = f(p0)` until
+ * the difference between successive iterations is less than the specified `tolerance`.
+ *
+ * @param p0 The initial guess for the fixed point.
+ * @param f The callable used to compute the fixed point.
+ * @param tolerance The convergence criterion. The iteration stops when `|p - p0| < tolerance`.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged` or `MaxIterationsReached`.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr BasicSolveResult<T> try_fixed_point_solver(std::type_identity_t<T> p0, F&& f, std::type_identity_t<T> tolerance = 1e-6,
+                                                     int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    BasicSolveResult<T> result;
+    result.root = p0;
+    int i = 1;
+    detail::start_table(observer, "fixed_point", {{"Iteration", 10}, {"p", 15}, {"f(p)", 15}});
+    while (i <= maxIterations) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        T p = f(p0);
+        result.evaluations++;
+        result.iterations = i;
+        result.root = p;
+        result.fRoot = p - p0;
+        if (detail::magnitude(p - p0) < tolerance) {
+            observer.on_converged(double(p));
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        observer.on_iteration(i, {double(p0), double(p)});
+        i = i + 1;
+        p0 = p;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds a fixed point of a function using the fixed-point iteration method.
+ *
+ * Throwing form of try_fixed_point_solver().
+ *
+ * @return double The computed fixed point if the method converges within the given number of iterations.
+ * @throws std::runtime_error If the method fails to converge to a solution within the specified number of iterations.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr T fixed_point_solver(std::type_identity_t<T> p0, F&& f, std::type_identity_t<T> tolerance = 1e-6,
+                               int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    return detail::iteration_root(try_fixed_point_solver<T>(p0, std::forward<F>(f), tolerance, maxIterations,
+                                                         std::forward<Observer>(observer)), maxIterations);
+}
+
+/**
+ * @brief Finds the root of a function using the Newton-Raphson method, without throwing.
+ *
+ * This function implements the Newton-Raphson method, an iterative root-finding algorithm.
+ * Starting from an initial guess, it refines the estimate of the root by using the function's derivative.
+ * This method is faster than the bisection method but requires the function's derivative.
+ * How the derivative is obtained is chosen by a derivative policy (see derivative-policies.h); the
+ * default is exact by automatic differentiation when `f` is generic over its argument type and a
+ * central difference otherwise.
+ *
+ * @param p0 The initial estimate for the root.
+ * @param f The callable whose root is being sought.
+ * @param tolerance The convergence criterion. The algorithm stops when |p - p0| < tolerance
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param derivative The derivative policy computing f(p0) and f'(p0) each iteration.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `ZeroDerivative` if the derivative vanishes at an
+ *         iterate, or `MaxIterationsReached`.
+ */
+template <typename T = double, typename F, typename Derivative = AutomaticDerivative, typename Observer = NullObserver>
+constexpr BasicSolveResult<T> try_newton_raphson_solver(std::type_identity_t<T> p0, F&& f, std::type_identity_t<T> tolerance = 1e-6,
+                                                        int maxIterations = 1000000, Derivative&& derivative = Derivative{},
+                                                        Observer&& observer = Observer{}) {
+    BasicSolveResult<T> result;
+    result.root = p0;
+    int i = 1;
+
+    detail::start_table(observer, "newton_raphson",
+                        {{"Iteration", 10}, {"p0", 15}, {"f(p0)", 15}, {"f'p(0)", 15}, {"p0 - f(p0)/f'(p0)", 20}});
+    while (i <= maxIterations) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        auto y = derivative(f, p0);
+        T fp = T(y.value);
+        T fPrimeP0 = T(y.derivative);
+        result.evaluations += y.evaluations;
+        result.fRoot = fp;
+
+        if (fPrimeP0 == 0) {
+            result.status = SolveStatus::ZeroDerivative;
+            return result;
+        }
+
+        T p = p0 - fp / fPrimeP0;
+        result.iterations = i;
+        result.root = p;
+
+        observer.on_iteration(i, {double(p0), double(fp), double(fPrimeP0), double(p)});
+
+        if (detail::magnitude(p - p0) < tolerance) {
+            observer.on_converged(double(p));
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+
+        p0 = p;
+        i++;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using the Newton-Raphson method.
+ *
+ * Throwing form of try_newton_raphson_solver().
+ *
+ * @return double The approximate root of the function if it converges within the given number of iterations.
+ * @throws std::invalid_argument If the derivative vanishes at an iterate.
+ * @throws std::runtime_error If the method fails to converge to a solution within the specified number of iterations.
+ */
+template <typename T = double, typename F, typename Derivative = AutomaticDerivative, typename Observer = NullObserver>
+constexpr T newton_raphson_solver(std::type_identity_t<T> p0, F&& f, std::type_identity_t<T> tolerance = 1e-6,
+                                  int maxIterations = 1000000, Derivative&& derivative = Derivative{},
+                                  Observer&& observer = Observer{}) {
+    return detail::newton_raphson_root(try_newton_raphson_solver<T>(p0, std::forward<F>(f), tolerance, maxIterations,
+                                                                 std::forward<Derivative>(derivative),
+                                                                 std::forward<Observer>(observer)), maxIterations);
+}
+
+/**
+ * @brief Finds the root of a function using the Secant method, without throwing.
+ *
+ * This function implements the Secant method, an iterative root-finding algorithm.
+ * Unlike the Newton-Raphson method, the Secant method does not require the calculation of derivatives.
+ * Instead, it approximates the derivative using the difference between function values at two points.
+ *
+ * The algorithm begins with two initial approximations `p0` and `p1` and iteratively improves these
+ * estimates until the difference between consecutive approximations is less than the specified `tolerance`,
+ * or until the maximum number of iterations is reached.
+ *
+ * @param p0 The first initial estimate for the root.
+ * @param p1 The second initial estimate for the root.
+ * @param f The callable whose root is being sought.
+ * @param tolerance The convergence criterion. The algorithm stops when |p_n - p_(n-1)| < tolerance.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged` or `MaxIterationsReached`.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr BasicSolveResult<T> try_secant_solver(std::type_identity_t<T> p0, std::type_identity_t<T> p1, F&& f,
+                                                std::type_identity_t<T> tolerance = 1e-6, int maxIterations = 1000000,
+                                                Observer&& observer = Observer{}) {
+    BasicSolveResult<T> result;
+    int i = 2;
+
+    T q0 = f(p0);
+    T q1 = f(p1);
+    result.evaluations = 2;
+    result.root = p1;
+    result.fRoot = q1;
+
+    detail::start_table(observer, "secant",
+                        {{"Iteration", 10}, {"p_(n-2)", 15}, {"p_(n-1)", 15}, {"f(p_(n-2))", 15}, {"f(p_(n-1))", 15},
+                         {"p_n", 15}});
+    while (i <= maxIterations) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        T p = p1 - q1 * (p1 - p0)/(q1 - q0);
+        result.iterations = i - 1;
+        result.root = p;
+
+        if (detail::magnitude(p - p0) < tolerance) {
+            observer.on_converged(double(p));
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+
+        observer.on_iteration(i, {double(p0), double(p1), double(q0), double(q1), double(p)});
+
+        i = i + 1;
+
+        p0 = p1;
+        q0 = q1;
+        p1 = p;
+        q1 = f(p);
+        result.evaluations++;
+        result.fRoot = q1;
+    }
+
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using the Secant method.
+ *
+ * Throwing form of try_secant_solver().
+ *
+ * @return double The approximate root of the function if it converges within the given number of iterations.
+ * @throws std::runtime_error If the method fails to converge to a solution within the specified number of iterations.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr T secant_solver(std::type_identity_t<T> p0, std::type_identity_t<T> p1, F&& f, std::type_identity_t<T> tolerance = 1e-6,
+                          int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    return detail::iteration_root(try_secant_solver<T>(p0, p1, std::forward<F>(f), tolerance, maxIterations,
+                                                    std::forward<Observer>(observer)), maxIterations);
+}
+
+/**
+ * @brief Finds the root of a function using the False Position method, without throwing.
+ *
+ * This function implements the False Position method (also known as the Regula Falsi method),
+ * an iterative root-finding algorithm. The method combines features of the bisection method
+ * and the secant method to find a root of a function. It starts with two initial points,
+ * `p0` and `p1`, such that the function values at these points have opposite signs,
+ * indicating that a root lies between them.
+ *
+ * The method iteratively refines these estimates by computing a new point `p` that lies on
+ * the line connecting `(p0, f(p0))` and `(p1, f(p1))` and updates the bounds based on the sign
+ * of the function at the new point.
+ *
+ * @param p0 The first initial estimate for the root.
+ * @param p1 The second initial estimate for the root.
+ * @param f The callable whose root is being sought.
+ * @param tolerance The convergence criterion. The algorithm stops when |p_n - p_(n-1)| < tolerance.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if the initial function values at
+ *         `p0` and `p1` do not have opposite signs, or `MaxIterationsReached`.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr BasicSolveResult<T> try_false_position_solver(std::type_identity_t<T> p0, std::type_identity_t<T> p1, F&& f,
+                                                        std::type_identity_t<T> tolerance = 1e-6, int maxIterations = 1000000,
+                                                        Observer&& observer = Observer{}) {
+    BasicSolveResult<T> result;
+    int i = 2;
+
+    T q0 = f(p0);
+    T q1 = f(p1);
+    result.evaluations = 2;
+    result.root = p1;
+    result.fRoot = q1;
+
+    if (q0 * q1 > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+
+    detail::start_table(observer, "false_position",
+                        {{"Iteration", 10}, {"p_(n-2)", 15}, {"p_(n-1)", 15}, {"f(p_(n-2))", 15}, {"f(p_(n-1))", 15},
+                         {"p_n", 15}});
+
+    while (i <= maxIterations) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        T p = p1 - q1 * (p1 - p0) / (q1 - q0);
+        result.iterations = i - 1;
+        result.root = p;
+
+        observer.on_iteration(i, {double(p0), double(p1), double(q0), double(q1), double(p)});
+
+        if (detail::magnitude(p - p1) < tolerance) {
+            observer.on_converged(double(p));
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+
+        T q = f(p);
+        result.evaluations++;
+        result.fRoot = q;
+
+        if (q * q1 < 0) {
+            p0 = p1;
+            q0 = q1;
+        }
+
+        p1 = p;
+        q1 = q;
+        i = i + 1;
+    }
+
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using the False Position method.
+ *
+ * Throwing form of try_false_position_solver().
+ *
+ * @return double The approximate root of the function if it converges within the given number of iterations.
+ * @throws std::invalid_argument If the initial function values at `p0` and `p1` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to converge to a solution within the specified number of iterations.
+ */
+template <typename T = double, typename F, typename Observer = NullObserver>
+constexpr T false_position_solver(std::type_identity_t<T> p0, std::type_identity_t<T> p1, F&& f,
+                                  std::type_identity_t<T> tolerance = 1e-6, int maxIterations = 1000000,
+                                  Observer&& observer = Observer{}) {
+    return detail::false_position_root(try_false_position_solver<T>(p0, p1, std::forward<F>(f), tolerance, maxIterations,
+                                                                 std::forward<Observer>(observer)), maxIterations);
+}
+
+// Overloads of the try_ solvers taking a StoppingCriteria instead of (tolerance, maxIterations)
+
+/**
+ * @brief try_bisection_solver() under a StoppingCriteria (see stopping-criteria.h).
+ *
+ * The x tolerance bounds the width of the final bracket: the solve runs as many halvings as bring
+ * the bracket below it, and its own |f(p)| criterion uses the residual tolerance.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_bisection_solver(double leftBound, double rightBound, F&& f, const StoppingCriteria& criteria,
+                                 Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(leftBound), std::abs(rightBound)));
+    // Without an x tolerance (or an empty bracket) only the residual and the iteration limit stop it
+    double neededHalvings = std::log2(std::abs(rightBound - leftBound) / tolerance);
+    bool bounded = tolerance > 0 && std::isfinite(neededHalvings) && neededHalvings < criteria.maxIterations;
+    int halvings = bounded ? std::max(static_cast<int>(std::ceil(neededHalvings)), 1) : 0;
+    int maxIterations = bounded ? std::min(criteria.maxIterations, halvings) : criteria.maxIterations;
+    SolveResult result = detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_bisection_solver(leftBound, rightBound, objective, criteria.residualTolerance, maxIterations,
+                                    budgetObserver);
+    });
+    if (result.status == SolveStatus::MaxIterationsReached && bounded && maxIterations == halvings) {
+        result.status = SolveStatus::Converged;
+    }
+    return result;
+}
+
+/**
+ * @brief try_fixed_point_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_fixed_point_solver(double p0, F&& f, const StoppingCriteria& criteria,
+                                   Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(p0);
+    return detail::solve_with_criteria(f, criteria, true, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_fixed_point_solver(p0, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_newton_raphson_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Derivative = AutomaticDerivative, typename Observer = NullObserver>
+SolveResult try_newton_raphson_solver(double p0, F&& f, const StoppingCriteria& criteria,
+                                      Derivative&& derivative = Derivative{}, Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(p0);
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_newton_raphson_solver(p0, objective, tolerance, criteria.maxIterations, derivative, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_secant_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_secant_solver(double p0, double p1, F&& f, const StoppingCriteria& criteria,
+                              Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(p0), std::abs(p1)));
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_secant_solver(p0, p1, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_false_position_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_false_position_solver(double p0, double p1, F&& f, const StoppingCriteria& criteria,
+                                      Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(std::max(std::abs(p0), std::abs(p1)));
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_false_position_solver(p0, p1, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
 #endif //EQUATIONS_SOLVER_H
@@ -0,0 +1,250 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef HIGHER_ORDER_SOLVERS_H
+#define HIGHER_ORDER_SOLVERS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "solve-result.h"
+#include "solver-error.h"
+#include "solver-observers.h"
+#include "stopping-criteria.h"
+#include "taylor-jet.h"
+
+// Root finders of higher order than Newton-Raphson. They need f'' (Halley) or f'' and f'''
+// (Householder) on top of f', all taken from a single evaluation of f on a Taylor jet (see
+// taylor-jet.h). Per iteration they cost about as much as a Newton step with dual numbers, but
+// converge cubically (Halley) or quartically (Householder), so they need fewer evaluations per root
+// when f itself is the expensive part.
+
+namespace detail {
+
+/**
+ * @brief f and its first N derivatives at x.
+ *
+ * One evaluation on a Taylor jet when f is generic over its argument type. Otherwise, e.g. for a
+ * function pointer, central differences on 3 (N <= 2) or 5 (N = 3) points around x with a step scaled to
+ * eps^(1/(N+2))·max(|x|, 1); that path is much less accurate and only meant as a fallback.
+ *
+ * @param evaluations Incremented by the number of evaluations of f spent.
+ */
+template <std::size_t N, typename F>
+Jet<double, N> taylor_coefficients(F&& f, double x, int& evaluations) {
+    static_assert(N >= 1 && N <= 3, "finite-difference fallback only covers up to the third derivative");
+    if constexpr (JetDifferentiable<F, N>) {
+        evaluations += 1;
+        return f(Jet<double, N>::variable(x));
+    } else {
+        const double h = std::pow(std::numeric_limits<double>::epsilon(), 1.0 / (N + 2)) * std::max(std::abs(x), 1.0);
+        double f0 = f(x), fPlus = f(x + h), fMinus = f(x - h);
+        evaluations += 3;
+        Jet<double, N> jet(f0);
+        jet.c[1] = (fPlus - fMinus) / (2 * h);
+        if constexpr (N >= 2) {
+            jet.c[2] = (fPlus - 2 * f0 + fMinus) / (h * h) / 2;
+        }
+        if constexpr (N >= 3) {
+            double fPlus2 = f(x + 2 * h), fMinus2 = f(x - 2 * h);
+            evaluations += 2;
+            jet.c[3] = (fPlus2 - 2 * fPlus + 2 * fMinus - fMinus2) / (2 * h * h * h) / 6;
+        }
+        return jet;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Finds the root of a function using Halley's method, without throwing.
+ *
+ * Halley's method uses the second derivative as well:
+ * p = p0 - 2 f f' / (2 f'² - f f''), evaluated at p0. It converges cubically near a simple root,
+ * so it typically needs 2-3 iterations where Newton-Raphson needs 4-6.
+ *
+ * @param p0 The initial estimate for the root.
+ * @param f The callable whose root is being sought; generic over its argument type to get exact derivatives.
+ * @param tolerance The convergence criterion. The algorithm stops when |p - p0| < tolerance
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `ZeroDerivative` if the denominator of the step
+ *         vanishes, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_halley_solver(double p0, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                              Observer&& observer = Observer{}) {
+    SolveResult result;
+    result.root = p0;
+
+    detail::start_table(observer, "halley",
+                        {{"Iteration", 10}, {"p0", 15}, {"f(p0)", 15}, {"f'(p0)", 15}, {"f''(p0)", 15}, {"p", 15}});
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        Jet<double, 2> y = detail::taylor_coefficients<2>(f, p0, result.evaluations);
+        double fp = y.value();
+        double d1 = y.derivative(1);
+        double d2 = y.derivative(2);
+        result.fRoot = fp;
+
+        double denominator = 2 * d1 * d1 - fp * d2;
+        if (denominator == 0) {
+            result.status = SolveStatus::ZeroDerivative;
+            return result;
+        }
+        double p = p0 - 2 * fp * d1 / denominator;
+        result.iterations = i;
+        result.root = p;
+
+        observer.on_iteration(i, {p0, fp, d1, d2, p});
+
+        if (std::abs(p - p0) < tolerance) {
+            observer.on_converged(p);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        p0 = p;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using Halley's method.
+ *
+ * Throwing form of try_halley_solver().
+ *
+ * @return double The approximate root of the function if it converges within the given number of iterations.
+ * @throws std::invalid_argument If the denominator of the Halley step vanishes at an iterate.
+ * @throws std::runtime_error If the method fails to converge to a solution within the specified number of iterations.
+ */
+template <typename F, typename Observer = NullObserver>
+double halley_solver(double p0, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                     Observer&& observer = Observer{}) {
+    SolveResult result = try_halley_solver(p0, std::forward<F>(f), tolerance, maxIterations,
+                                           std::forward<Observer>(observer));
+    if (result.status == SolveStatus::ZeroDerivative) {
+        throw std::invalid_argument("Derivative is zero at the current guess; the algorithm cannot proceed.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " steps.");
+    }
+    return result.root;
+}
+
+/**
+ * @brief Finds the root of a function using Householder's method of order 3, without throwing.
+ *
+ * The next member of the family after Newton-Raphson (order 1) and Halley (order 2), using up to
+ * the third derivative: p = p0 - (6 f f'² - 3 f² f'') / (6 f'³ - 6 f f' f'' + f² f'''). It converges
+ * with order 4 near a simple root.
+ *
+ * @param p0 The initial estimate for the root.
+ * @param f The callable whose root is being sought; generic over its argument type to get exact derivatives.
+ * @param tolerance The convergence criterion. The algorithm stops when |p - p0| < tolerance
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `ZeroDerivative` if the denominator of the step
+ *         vanishes, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_householder_solver(double p0, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                                   Observer&& observer = Observer{}) {
+    SolveResult result;
+    result.root = p0;
+
+    detail::start_table(observer, "householder",
+                        {{"Iteration", 10}, {"p0", 15}, {"f(p0)", 15}, {"f'(p0)", 15}, {"f''(p0)", 15},
+                         {"f'''(p0)", 15}, {"p", 15}});
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        Jet<double, 3> y = detail::taylor_coefficients<3>(f, p0, result.evaluations);
+        double fp = y.value();
+        double d1 = y.derivative(1);
+        double d2 = y.derivative(2);
+        double d3 = y.derivative(3);
+        result.fRoot = fp;
+
+        double denominator = 6 * d1 * d1 * d1 - 6 * fp * d1 * d2 + fp * fp * d3;
+        if (denominator == 0) {
+            result.status = SolveStatus::ZeroDerivative;
+            return result;
+        }
+        double p = p0 - (6 * fp * d1 * d1 - 3 * fp * fp * d2) / denominator;
+        result.iterations = i;
+        result.root = p;
+
+        observer.on_iteration(i, {p0, fp, d1, d2, d3, p});
+
+        if (std::abs(p - p0) < tolerance) {
+            observer.on_converged(p);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        p0 = p;
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function using Householder's method of order 3.
+ *
+ * Throwing form of try_householder_solver().
+ *
+ * @return double The approximate root of the function if it converges within the given number of iterations.
+ * @throws std::invalid_argument If the denominator of the Householder step vanishes at an iterate.
+ * @throws std::runtime_error If the method fails to converge to a solution within the specified number of iterations.
+ */
+template <typename F, typename Observer = NullObserver>
+double householder_solver(double p0, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                          Observer&& observer = Observer{}) {
+    SolveResult result = try_householder_solver(p0, std::forward<F>(f), tolerance, maxIterations,
+                                                std::forward<Observer>(observer));
+    if (result.status == SolveStatus::ZeroDerivative) {
+        throw std::invalid_argument("Derivative is zero at the current guess; the algorithm cannot proceed.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " steps.");
+    }
+    return result.root;
+}
+
+// Overloads of the try_ solvers taking a StoppingCriteria instead of (tolerance, maxIterations)
+
+/**
+ * @brief try_halley_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_halley_solver(double p0, F&& f, const StoppingCriteria& criteria,
+                              Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(p0);
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_halley_solver(p0, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+/**
+ * @brief try_householder_solver() under a StoppingCriteria (see stopping-criteria.h).
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_householder_solver(double p0, F&& f, const StoppingCriteria& criteria,
+                                   Observer&& observer = Observer{}) {
+    double tolerance = criteria.tolerance(p0);
+    return detail::solve_with_criteria(f, criteria, false, observer, [&](auto& objective, auto& budgetObserver) {
+        return try_householder_solver(p0, objective, tolerance, criteria.maxIterations, budgetObserver);
+    });
+}
+
+#endif //HIGHER_ORDER_SOLVERS_H
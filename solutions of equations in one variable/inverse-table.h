@@ -0,0 +1,231 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef INVERSE_TABLE_H
+#define INVERSE_TABLE_H
+
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "batch-solvers.h"
+#include "bracketing-solvers.h"
+#include "solve-result.h"
+#include "solver-error.h"
+
+// Lookup table for inverting a monotone f, a lighter companion of ChebyshevProxy (see
+// chebyshev-proxy.h) that needs no smoothness.
+//
+// f is sampled once on a uniform grid. A query y is located in the grid cell [x_i, x_(i+1)] whose
+// values enclose it, found by a branch-free search over the values stored in Eytzinger (breadth-first)
+// order, where the first levels of the implicit search tree share a few cache lines. The cell is then
+// a tight KnownBracket for try_chandrupatla_solver(), whose first step is the linear interpolation of
+// the table and costs nothing: the table supplies f at both cell ends. Unlike false position it keeps
+// shrinking the bracket from both sides, also near a multiple root, so a query takes about four
+// evaluations of a smooth f, against the 20 or more of a bisection over the whole interval.
+//
+// The batch solve walks the table from the cell of the previous query, so queries that arrive
+// sorted are located without any search.
+
+// Default number of grid cells of an InverseTable.
+inline constexpr std::size_t inverseTableCells = 1024;
+
+/**
+ * @brief Grid of a monotone f on [leftBound, rightBound] for solving f(x) = y quickly for many y.
+ *
+ *     InverseTable table(f, 0.0, 10.0);
+ *     double x = table.solve(2.5);          // f(x) = 2.5
+ *
+ * f may be increasing or decreasing. It is stored by value (wrap it in std::ref to keep a reference)
+ * and is called again from the const solve functions, so it must be callable as const.
+ */
+template <typename F>
+class InverseTable {
+public:
+    /**
+     * @brief Samples f on `cells` + 1 equally spaced points.
+     *
+     * @throws std::invalid_argument If leftBound is not below rightBound, cells is zero, or f is not
+     *         strictly monotone on the grid.
+     */
+    InverseTable(F f, double leftBound, double rightBound, std::size_t cells = inverseTableCells)
+        : function(std::move(f)), xs(cells + 1), ys(cells + 1), keys(cells + 1) {
+        if (!(leftBound < rightBound) || cells == 0) {
+            throw std::invalid_argument("The interval must satisfy leftBound < rightBound and have at least one cell.");
+        }
+        double spacing = (rightBound - leftBound) / static_cast<double>(cells);
+        for (std::size_t i = 0; i <= cells; i++) {
+            xs[i] = i == cells ? rightBound : leftBound + static_cast<double>(i) * spacing;
+            ys[i] = function(xs[i]);
+        }
+        direction = ys[cells] < ys[0] ? -1 : 1;
+        for (std::size_t i = 0; i <= cells; i++) {
+            keys[i] = direction * ys[i];
+            if (i > 0 && !(keys[i - 1] < keys[i])) {
+                throw std::invalid_argument("The function must be strictly monotone on the interval.");
+            }
+        }
+
+        eytzinger.resize(cells + 2);
+        eytzingerIndex.resize(cells + 2);
+        std::size_t next = 0;
+        build_eytzinger(1, next);
+    }
+
+    std::size_t cells() const { return xs.size() - 1; }
+
+    // Evaluations of f spent to build the table.
+    std::size_t build_evaluations() const { return xs.size(); }
+
+    /**
+     * @brief The cell i with y between f(x_i) and f(x_(i+1)), by search of the Eytzinger layout.
+     *
+     * @return The cell index, or cells() if y is outside the range of f on the interval.
+     */
+    std::size_t find_cell(double y) const {
+        double key = direction * y;
+        std::size_t n = keys.size();
+        std::size_t k = 1;
+        while (k <= n) {
+            k = 2 * k + (eytzinger[k] <= key);
+        }
+        // Undo the right turns taken after the last left turn: k is then the first key greater than y
+        k >>= std::countr_one(k) + 1;
+        std::size_t upper = k == 0 ? n : eytzingerIndex[k];
+        return cell_below(upper, key);
+    }
+
+    /**
+     * @brief Solves f(x) = y, without throwing.
+     *
+     * @param y The right-hand side.
+     * @param tolerance The refinement stops when the bracket around the root is narrower than 2·tolerance.
+     * @param maxIterations The maximum number of iterations of the refinement.
+     * @return SolveResult whose `evaluations` counts the evaluations of f spent after the table lookup;
+     *         status `InvalidBracket` if y is outside the range of f on the interval.
+     */
+    SolveResult try_solve(double y, double tolerance = 1e-12, int maxIterations = 100) const {
+        return solve_in_cell(find_cell(y), y, tolerance, maxIterations);
+    }
+
+    /**
+     * @brief Solves f(x) = y.
+     *
+     * Throwing form of try_solve().
+     *
+     * @throws std::invalid_argument If y is outside the range of f on the interval.
+     * @throws std::runtime_error If the refinement does not converge within maxIterations iterations.
+     */
+    double solve(double y, double tolerance = 1e-12, int maxIterations = 100) const {
+        SolveResult result = try_solve(y, tolerance, maxIterations);
+        if (result.status == SolveStatus::InvalidBracket) {
+            throw std::invalid_argument("The right-hand side is outside the range of the function on the interval.");
+        }
+        if (!result.converged()) {
+            throw SolverError(result.status, "No solution found after ", maxIterations, " steps.");
+        }
+        return result.root;
+    }
+
+    /**
+     * @brief Solves f(x) = targets[i] for every i, walking the table between consecutive queries.
+     *
+     * Each query starts from the cell of the previous one and moves cell by cell; after a few cells
+     * it falls back to find_cell(). Sorted queries, in either order, are thus located without search.
+     *
+     * @param results Where roots, statuses and (optionally) refinement iteration counts are stored.
+     * @return std::size_t The number of queries that converged.
+     * @throws std::invalid_argument If the spans do not all have the same size.
+     */
+    std::size_t solve(std::span<const double> targets, const BatchResults& results, double tolerance = 1e-12,
+                      int maxIterations = 100) const {
+        detail::check_batch_sizes(targets.size(), targets.size(), results);
+        constexpr int maxWalk = 8;
+        const std::size_t last = cells() - 1;
+
+        std::size_t converged = 0;
+        std::size_t cell = cells();
+        for (std::size_t i = 0; i < targets.size(); i++) {
+            double key = direction * targets[i];
+            if (cell != cells()) {
+                int steps = 0;
+                while (cell < last && keys[cell + 1] <= key && steps < maxWalk) {
+                    cell++;
+                    steps++;
+                }
+                while (cell > 0 && key < keys[cell] && steps < maxWalk) {
+                    cell--;
+                    steps++;
+                }
+            }
+            if (cell == cells() || key < keys[cell] || key > keys[cell + 1]) {
+                cell = find_cell(targets[i]);
+            }
+
+            SolveResult result = solve_in_cell(cell, targets[i], tolerance, maxIterations);
+            results.roots[i] = result.root;
+            results.status[i] = result.status;
+            if (!results.iterations.empty()) {
+                results.iterations[i] = result.iterations;
+            }
+            converged += result.converged();
+        }
+        return converged;
+    }
+
+private:
+    // In-order traversal of the implicit tree fills eytzinger[1..n] with the sorted keys.
+    void build_eytzinger(std::size_t k, std::size_t& next) {
+        if (k > keys.size()) {
+            return;
+        }
+        build_eytzinger(2 * k, next);
+        eytzinger[k] = keys[next];
+        eytzingerIndex[k] = next;
+        next++;
+        build_eytzinger(2 * k + 1, next);
+    }
+
+    // The cell ending at the first key greater than `key`, or cells() if there is none.
+    std::size_t cell_below(std::size_t upper, double key) const {
+        if (upper == 0) {
+            return cells();
+        }
+        if (upper == keys.size()) {
+            return key == keys.back() ? cells() - 1 : cells();
+        }
+        return upper - 1;
+    }
+
+    SolveResult solve_in_cell(std::size_t cell, double y, double tolerance, int maxIterations) const {
+        SolveResult result;
+        if (cell >= cells()) {
+            result.status = SolveStatus::InvalidBracket;
+            return result;
+        }
+        for (std::size_t i = cell; i <= cell + 1; i++) {
+            if (ys[i] == y) {
+                result.root = xs[i];
+                result.status = SolveStatus::Converged;
+                return result;
+            }
+        }
+        // f - y, whose values at the two ends of the cell come from the table
+        auto shifted = [this, y](double x) { return function(x) - y; };
+        return try_chandrupatla_solver(KnownBracket{xs[cell], ys[cell] - y, xs[cell + 1], ys[cell + 1] - y}, shifted,
+                                       tolerance, maxIterations);
+    }
+
+    F function;
+    int direction = 1;
+    std::vector<double> xs, ys;
+    std::vector<double> keys;                   // direction·ys, increasing
+    std::vector<double> eytzinger;              // keys in Eytzinger order, 1-based
+    std::vector<std::size_t> eytzingerIndex;    // position in `keys` of every Eytzinger entry
+};
+
+#endif //INVERSE_TABLE_H
@@ -0,0 +1,325 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "iteration-trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace {
+
+constexpr char traceMagic[8] = {'N', 'A', 'T', 'R', 'A', 'C', 'E', '2'};
+
+struct TraceLayout {
+    std::string solver;
+    std::vector<std::string> names;
+    std::vector<int> widths;
+};
+
+// Rings and layouts of the process. Rings outlive their threads, so the records of a finished
+// thread are still written by the next write_trace().
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TraceRing>> rings;
+    std::vector<std::uint64_t> cursors;     // first record of each ring not written yet
+    std::vector<TraceLayout> layouts;       // layout id - 1
+    TickCalibration clock;
+};
+
+// Never destroyed, so threads still tracing during static destruction find it alive.
+TraceRegistry& trace_registry() {
+    static TraceRegistry* registry = new TraceRegistry;
+    return *registry;
+}
+
+std::atomic<bool> tracingEnabled = false;
+
+// A layout the calling thread has already registered, keyed by the addresses of its solver and
+// column names, which are string literals in the solvers.
+struct CachedLayout {
+    const char* solver;
+    std::vector<const char*> names;
+    std::uint32_t id;
+};
+
+bool same_layout(const CachedLayout& cached, const char* solver, std::initializer_list<IterationColumn> columns) {
+    if (cached.solver != solver || cached.names.size() != columns.size()) {
+        return false;
+    }
+    return std::equal(columns.begin(), columns.end(), cached.names.begin(),
+                      [](const IterationColumn& column, const char* name) { return column.name == name; });
+}
+
+template <typename T>
+void put(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+template <typename T>
+bool get(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof value));
+}
+
+} // namespace
+
+std::uint64_t TraceRing::read(std::uint64_t& cursor, std::vector<TraceRecord>& out) const {
+    const std::uint64_t capacity = mask + 1;
+    const std::uint64_t end = head.load(std::memory_order_acquire);
+    std::uint64_t begin = cursor;
+    std::uint64_t lost = 0;
+    if (end - begin > capacity) {
+        lost = end - capacity - begin;
+        begin = end - capacity;
+    }
+
+    const std::size_t first = out.size();
+    for (std::uint64_t index = begin; index < end; index++) {
+        const std::atomic<std::uint64_t>* slot = &words[(index & mask) * 8];
+        TraceRecord record;
+        record.timestamp = slot[0].load(std::memory_order_acquire);
+        record.header = slot[1].load(std::memory_order_acquire);
+        for (std::size_t k = 0; k < TraceRecord::maxValues; k++) {
+            record.values[k] = std::bit_cast<double>(slot[2 + k].load(std::memory_order_acquire));
+        }
+        out.push_back(record);
+    }
+
+    // The writer may have lapped the copy: record `now` overwrites the slot of record now - capacity,
+    // so only the records after that one are known to be intact. The acquire loads above order
+    // this load after them.
+    const std::uint64_t now = head.load(std::memory_order_relaxed);
+    if (now >= capacity && now - capacity + 1 > begin) {
+        const std::uint64_t torn = std::min(now - capacity + 1, end) - begin;
+        out.erase(out.begin() + static_cast<std::ptrdiff_t>(first),
+                  out.begin() + static_cast<std::ptrdiff_t>(first + torn));
+        lost += torn;
+    }
+    cursor = end;
+    return lost;
+}
+
+void set_tracing_enabled(bool enabled) {
+    tracingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool tracing_enabled() {
+    return tracingEnabled.load(std::memory_order_relaxed);
+}
+
+std::size_t write_trace(std::ostream& out) {
+    TraceRegistry& registry = trace_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    out.write(traceMagic, sizeof traceMagic);
+    put(out, registry.clock.nanoseconds_per_tick());
+    put(out, static_cast<std::uint32_t>(registry.layouts.size()));
+    for (const TraceLayout& layout : registry.layouts) {
+        put(out, static_cast<std::uint32_t>(layout.solver.size()));
+        out.write(layout.solver.data(), static_cast<std::streamsize>(layout.solver.size()));
+        put(out, static_cast<std::uint32_t>(layout.names.size()));
+        for (std::size_t c = 0; c < layout.names.size(); c++) {
+            put(out, static_cast<std::int32_t>(layout.widths[c]));
+            put(out, static_cast<std::uint32_t>(layout.names[c].size()));
+            out.write(layout.names[c].data(), static_cast<std::streamsize>(layout.names[c].size()));
+        }
+    }
+
+    std::size_t written = 0;
+    std::vector<TraceRecord> records;
+    put(out, static_cast<std::uint32_t>(registry.rings.size()));
+    for (std::size_t r = 0; r < registry.rings.size(); r++) {
+        records.clear();
+        registry.rings[r]->read(registry.cursors[r], records);
+        put(out, static_cast<std::uint64_t>(registry.rings[r]->thread_index()));
+        put(out, static_cast<std::uint64_t>(records.size()));
+        out.write(reinterpret_cast<const char*>(records.data()),
+                  static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+        written += records.size();
+    }
+    return written;
+}
+
+bool decode_trace(std::istream& in, std::ostream& out) {
+    char magic[sizeof traceMagic];
+    if (!in.read(magic, sizeof magic) || std::memcmp(magic, traceMagic, sizeof magic) != 0) {
+        return false;
+    }
+
+    double nanosecondsPerTick = 0;
+    std::uint32_t layoutCount = 0;
+    if (!get(in, nanosecondsPerTick) || !get(in, layoutCount)) {
+        return false;
+    }
+    std::vector<TraceLayout> layouts(layoutCount);
+    for (TraceLayout& layout : layouts) {
+        std::uint32_t solverLength = 0;
+        if (!get(in, solverLength) || solverLength > 4096) {
+            return false;
+        }
+        layout.solver.resize(solverLength);
+        std::uint32_t columnCount = 0;
+        if (!in.read(layout.solver.data(), solverLength) || !get(in, columnCount)) {
+            return false;
+        }
+        for (std::uint32_t c = 0; c < columnCount; c++) {
+            std::int32_t width = 0;
+            std::uint32_t length = 0;
+            if (!get(in, width) || !get(in, length) || length > 4096) {
+                return false;
+            }
+            std::string name(length, '\0');
+            if (!in.read(name.data(), length)) {
+                return false;
+            }
+            layout.names.push_back(std::move(name));
+            layout.widths.push_back(width);
+        }
+    }
+
+    std::uint32_t ringCount = 0;
+    if (!get(in, ringCount)) {
+        return false;
+    }
+    for (std::uint32_t r = 0; r < ringCount; r++) {
+        std::uint64_t thread = 0;
+        std::uint64_t recordCount = 0;
+        if (!get(in, thread) || !get(in, recordCount)) {
+            return false;
+        }
+        std::vector<TraceRecord> records;
+        for (std::uint64_t k = 0; k < recordCount; k++) {
+            TraceRecord record;
+            if (!get(in, record)) {
+                return false;
+            }
+            records.push_back(record);
+        }
+
+        // Solves are runs from a Start record up to the next one; rows before the first Start
+        // belong to a solve whose beginning was overwritten.
+        std::size_t k = 0;
+        while (k < records.size() && records[k].kind() != TraceRecordKind::Start) {
+            k++;
+        }
+        if (k > 0) {
+            out << "# thread " << thread << ": " << k << " records of an overwritten solve skipped" << std::endl;
+        }
+        while (k < records.size()) {
+            const TraceRecord& start = records[k];
+            std::size_t next = k + 1;
+            while (next < records.size() && records[next].kind() != TraceRecordKind::Start) {
+                next++;
+            }
+
+            const std::uint32_t id = start.layout();
+            if (id == 0 || id > layouts.size()) {
+                return false;
+            }
+            const TraceLayout& layout = layouts[id - 1];
+            std::vector<IterationColumn> columns;
+            for (std::size_t c = 0; c < layout.names.size(); c++) {
+                columns.push_back({layout.names[c].c_str(), layout.widths[c]});
+            }
+
+            out << "# thread " << thread << ", solve " << static_cast<std::uint64_t>(start.values[0]) << ", ";
+            if (!layout.solver.empty()) {
+                out << layout.solver << ", ";
+            }
+            out << static_cast<double>(records[next - 1].timestamp - start.timestamp) * nanosecondsPerTick / 1000
+                << " us" << std::endl;
+            TablePrinter printer(out);
+            printer.print_header(columns);
+            for (std::size_t i = k + 1; i < next; i++) {
+                const TraceRecord& record = records[i];
+                if (record.kind() == TraceRecordKind::Iteration) {
+                    printer.print_row(record.iteration(), std::span<const double>(record.values, record.count()));
+                } else if (record.kind() == TraceRecordKind::Converged) {
+                    printer.on_converged(record.values[0]);
+                }
+            }
+            k = next;
+        }
+    }
+    return true;
+}
+
+namespace detail {
+
+TraceRing* register_trace_ring() {
+    TraceRegistry& registry = trace_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.rings.push_back(std::make_shared<TraceRing>(registry.rings.size()));
+    registry.cursors.push_back(0);
+    return registry.rings.back().get();
+}
+
+std::uint32_t trace_layout(const char* solver, std::initializer_list<IterationColumn> columns) {
+    static thread_local std::vector<CachedLayout> cache;
+    for (const CachedLayout& cached : cache) {
+        if (same_layout(cached, solver, columns)) {
+            return cached.id;
+        }
+    }
+
+    TraceRegistry& registry = trace_registry();
+    std::uint32_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (std::size_t l = 0; l < registry.layouts.size() && id == 0; l++) {
+            const TraceLayout& layout = registry.layouts[l];
+            bool same = layout.solver == solver && layout.names.size() == columns.size();
+            std::size_t c = 0;
+            for (auto column = columns.begin(); same && column != columns.end(); ++column, c++) {
+                same = layout.names[c] == column->name && layout.widths[c] == column->width;
+            }
+            if (same) {
+                id = static_cast<std::uint32_t>(l + 1);
+            }
+        }
+        if (id == 0) {
+            TraceLayout layout;
+            layout.solver = solver;
+            for (const IterationColumn& column : columns) {
+                layout.names.emplace_back(column.name);
+                layout.widths.push_back(column.width);
+            }
+            registry.layouts.push_back(std::move(layout));
+            id = static_cast<std::uint32_t>(registry.layouts.size());
+        }
+    }
+
+    CachedLayout cached{solver, {}, id};
+    for (const IterationColumn& column : columns) {
+        cached.names.push_back(column.name);
+    }
+    cache.push_back(std::move(cached));
+    return id;
+}
+
+std::uint32_t trace_start(const char* solver, std::initializer_list<IterationColumn> columns) {
+    if (!tracing_enabled()) {
+        return 0;
+    }
+    TraceObserver observer;
+    observer.on_start(solver, columns);
+    return observer.layout;
+}
+
+void trace_iteration(std::uint32_t layout, int i, std::initializer_list<double> values) {
+    if (layout != 0) {
+        trace_record(TraceRecordKind::Iteration, layout, i, values);
+    }
+}
+
+void trace_converged(std::uint32_t layout, double p) {
+    if (layout != 0) {
+        trace_record(TraceRecordKind::Converged, layout, 0, {p});
+    }
+}
+
+} // namespace detail
@@ -0,0 +1,196 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef ITERATION_TRACE_H
+#define ITERATION_TRACE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+#include "cycle-clock.h"
+#include "solver-observers.h"
+
+// Iteration tracing: a flight recorder of solver iterations, cheap enough to leave on in production.
+//
+// Every thread writes fixed-size TraceRecords into its own ring buffer with a handful of atomic
+// stores and no locks; when the ring is full the oldest records are overwritten. write_trace()
+// copies all rings, from any thread and while the solvers keep running, to a binary stream, and
+// decode_trace() (or the trace-decoder tool) renders it back into the iteration tables the solvers
+// print through TablePrinter.
+//
+// A record is one row of the iteration table of its solver: for the bracketing methods the values
+// are a, b, p and f(p), so the bracket width is b - a; for Newton-type methods p0, f(p0), f'(p0), ...
+// The layout of a table, the name of its solver and its columns, is stored once and identifies the
+// solver: bisection, Brent, Chandrupatla and ITP print the same columns but get a layout each.
+//
+// Tracing is attached in one of two ways:
+//   - explicitly, by passing a TraceObserver to a solver, which always records;
+//   - implicitly, by building with NUMERICAL_ANALYSIS_TRACING defined (the CMake option of the same
+//     name), which makes NullObserver and TablePrinter record too while set_tracing_enabled(true).
+//     Without the macro the default observer stays empty and tracing costs nothing.
+//
+// Binary format, in host byte order: the magic "NATRACE2"; a double with the nanoseconds per
+// timestamp tick; the layouts as a uint32 count and, per layout, the solver name as (uint32 length,
+// name bytes) and a uint32 column count followed by (int32 width, uint32 length, name bytes) per column;
+// then the rings as a uint32 count and, per ring, uint64 thread index, uint64 record count and the
+// 64-byte records.
+
+// Records kept per thread before the oldest are overwritten.
+inline constexpr std::size_t traceRingCapacity = 4096;
+
+enum class TraceRecordKind : std::uint8_t {
+    Start,      // a solve begins; values[0] is its sequence number on the thread
+    Iteration,  // one table row
+    Converged,  // values[0] is the accepted solution
+};
+
+// One record of the trace, 64 bytes.
+struct TraceRecord {
+    std::uint64_t timestamp = 0;    // cycle_clock_ticks()
+    std::uint64_t header = 0;       // kind (8 bits), layout id (16 bits), value count (8 bits), iteration (32 bits)
+    double values[6] = {};
+
+    static constexpr std::size_t maxValues = 6;
+
+    static std::uint64_t make_header(TraceRecordKind kind, std::uint32_t layout, std::size_t count, int iteration) {
+        return static_cast<std::uint64_t>(kind) | static_cast<std::uint64_t>(layout & 0xffff) << 8
+               | static_cast<std::uint64_t>(count & 0xff) << 24
+               | static_cast<std::uint64_t>(static_cast<std::uint32_t>(iteration)) << 32;
+    }
+
+    TraceRecordKind kind() const { return static_cast<TraceRecordKind>(header & 0xff); }
+    std::uint32_t layout() const { return static_cast<std::uint32_t>(header >> 8 & 0xffff); }
+    std::size_t count() const { return static_cast<std::size_t>(header >> 24 & 0xff); }
+    int iteration() const { return static_cast<int>(static_cast<std::uint32_t>(header >> 32)); }
+};
+
+static_assert(sizeof(TraceRecord) == 64, "trace records are one cache line");
+
+/**
+ * @brief Single-writer ring of TraceRecords that other threads can read while it is written.
+ *
+ * Records are stored as atomic words, and the reader validates what it copied against the
+ * head index afterwards (a sequence lock per record), so a copy never contains a torn record.
+ */
+class TraceRing {
+public:
+    explicit TraceRing(std::size_t threadIndex, std::size_t capacity = traceRingCapacity)
+        : thread(threadIndex), mask(std::bit_ceil(capacity) - 1), words(new std::atomic<std::uint64_t>[(mask + 1) * 8]) {}
+
+    // Appends a record; only ever called by the owning thread.
+    void write(const TraceRecord& record) {
+        std::uint64_t index = head.load(std::memory_order_relaxed);
+        // Release stores (plain stores on x86) order the head update of the previous record before
+        // the overwrite, so a reader seeing any word of this record also sees that head
+        std::atomic<std::uint64_t>* slot = &words[(index & mask) * 8];
+        slot[0].store(record.timestamp, std::memory_order_release);
+        slot[1].store(record.header, std::memory_order_release);
+        for (std::size_t k = 0; k < TraceRecord::maxValues; k++) {
+            slot[2 + k].store(std::bit_cast<std::uint64_t>(record.values[k]), std::memory_order_release);
+        }
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Appends to `out` the records written since `cursor` that are still in the ring.
+     *
+     * @param cursor The index of the first record not read yet; advanced past the records read.
+     * @return The number of records lost to overwriting since the cursor.
+     */
+    std::uint64_t read(std::uint64_t& cursor, std::vector<TraceRecord>& out) const;
+
+    std::size_t thread_index() const { return thread; }
+
+private:
+    std::size_t thread;
+    std::uint64_t mask;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> words;
+    std::atomic<std::uint64_t> head = 0;
+};
+
+// Turns the implicit tracing of NullObserver and TablePrinter on or off (see the top of this file).
+void set_tracing_enabled(bool enabled);
+bool tracing_enabled();
+
+/**
+ * @brief Writes the records of every thread not written by a previous call, in the binary format.
+ *
+ * May be called from any thread while solvers are tracing.
+ *
+ * @return The number of records written.
+ */
+std::size_t write_trace(std::ostream& out);
+
+/**
+ * @brief Renders a binary trace as iteration tables, one per traced solve, via TablePrinter.
+ *
+ * Each table is preceded by a line naming the thread, the solve, its solver and its duration.
+ *
+ * @return false if the stream is not a trace or is truncated.
+ */
+bool decode_trace(std::istream& in, std::ostream& out);
+
+namespace detail {
+
+// Creates and registers the ring of the calling thread.
+TraceRing* register_trace_ring();
+
+inline thread_local TraceRing* threadTraceRing = nullptr;
+
+// The ring of the calling thread, created on first use.
+inline TraceRing& thread_trace_ring() {
+    if (threadTraceRing == nullptr) {
+        threadTraceRing = register_trace_ring();
+    }
+    return *threadTraceRing;
+}
+
+// The id (from 1) of the layout of this solver with these columns, registered on first use.
+std::uint32_t trace_layout(const char* solver, std::initializer_list<IterationColumn> columns);
+
+inline void trace_record(TraceRecordKind kind, std::uint32_t layout, int iteration, std::initializer_list<double> values) {
+    TraceRecord record;
+    record.timestamp = cycle_clock_ticks();
+    std::size_t count = 0;
+    for (double value : values) {
+        if (count < TraceRecord::maxValues) {
+            record.values[count++] = value;
+        }
+    }
+    record.header = TraceRecord::make_header(kind, layout, count, iteration);
+    thread_trace_ring().write(record);
+}
+
+} // namespace detail
+
+/**
+ * @brief Observer recording every iteration into the trace of the calling thread.
+ *
+ * Can be combined with nothing else; to trace a solve and also print it, build with
+ * NUMERICAL_ANALYSIS_TRACING and use TablePrinter.
+ */
+struct TraceObserver {
+    std::uint32_t layout = 0;
+
+    void on_start(std::initializer_list<IterationColumn> columns) { on_start("", columns); }
+    void on_start(const char* solver, std::initializer_list<IterationColumn> columns) {
+        static thread_local std::uint64_t solves = 0;
+        layout = detail::trace_layout(solver, columns);
+        detail::trace_record(TraceRecordKind::Start, layout, 0, {static_cast<double>(solves++)});
+    }
+    void on_iteration(int i, std::initializer_list<double> values) {
+        detail::trace_record(TraceRecordKind::Iteration, layout, i, values);
+    }
+    void on_converged(double p) {
+        detail::trace_record(TraceRecordKind::Converged, layout, 0, {p});
+    }
+};
+
+#endif //ITERATION_TRACE_H
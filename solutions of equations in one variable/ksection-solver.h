@@ -0,0 +1,248 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef KSECTION_SOLVER_H
+#define KSECTION_SOLVER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <span>
+#include <utility>
+
+#include "bracketing-solvers.h"
+#include "solve-result.h"
+#include "solver-error.h"
+#include "solver-observers.h"
+#include "solver-workspace.h"
+#include "work-stealing-pool.h"
+
+// Parallel k-section for objectives so expensive that the number of sequential evaluations, not
+// the total, sets the time to a root.
+//
+// Every round evaluates k - 1 interior points of the bracket [a, b] at once, one per thread of a
+// WorkStealingPool, and keeps the subinterval with the sign change. Spread uniformly, the points
+// shrink the bracket by a factor of k per round instead of 2, so the rounds go down from
+// log2(width / tolerance) to logk(width / tolerance).
+//
+// Between rounds the gathered points are used as Brent's method uses its history: an inverse
+// quadratic interpolation through the new bracket and the nearest point outside it, checked against
+// the secant of the bracket, estimates the root. The next round then clusters its points in a
+// window around the estimate, whose width is the disagreement of the two interpolants. When the
+// root does lie in the window that round shrinks the bracket by far more than k. Half of the points
+// stay uniform over the bracket, so a round whose window misses still shrinks it by k / 2, and the
+// following round falls back to uniform points — the same safeguard that makes Brent's method
+// bisect after a poor interpolation step. With one thread the rounds alternate between the
+// interpolated point and bisection in the worst case.
+//
+// f is called concurrently from all threads of the pool and must be safe to call that way. Like the
+// other bracketing methods the solver stops once the bracket is narrower than 2·tolerance and
+// returns the end point with the smaller |f|; an iteration is one round. The points of a round live
+// in a SolverWorkspace, so with one passed in a solve does not allocate.
+
+namespace detail {
+
+// y[j] = f(x[j]) for j < count, one point per task of the pool
+template <typename F>
+void evaluate_points(WorkStealingPool& pool, F& f, const double* x, double* y, std::size_t count) {
+    pool.parallel_for(count, 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t j = begin; j < end; j++) {
+            y[j] = f(x[j]);
+        }
+    });
+}
+
+// Inverse quadratic interpolation of the root through three points, NaN if two values coincide
+inline double inverse_quadratic_estimate(double xa, double fa, double xb, double fb, double xc, double fc) {
+    if (fa == fb || fa == fc || fb == fc) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return xa * fb * fc / ((fa - fb) * (fa - fc)) + xb * fa * fc / ((fb - fa) * (fb - fc))
+         + xc * fa * fb / ((fc - fa) * (fc - fb));
+}
+
+} // namespace detail
+
+/**
+ * @brief Finds the root of a function by parallel k-section with interpolation, without throwing.
+ *
+ * Evaluates thread_count() interior points of the bracket per round on `pool`, so k is
+ * pool.thread_count() + 1 (see the comment at the top of this file). With a single thread this is
+ * bisection safeguarding an interpolation step.
+ *
+ * @param pool The threads evaluating f; its size sets the number of points per round.
+ * @param workspace Where the points of a round are kept.
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param f The callable for which the root is being sought, safe to call concurrently.
+ * @param tolerance The method stops when the bracket is narrower than 2·tolerance.
+ * @param maxIterations The maximum number of rounds.
+ * @param observer Receives the bracket after every round (see solver-observers.h); defaults to no output.
+ * @return SolveResult with status `Converged`, `InvalidBracket` if `f(leftBound)` and `f(rightBound)`
+ *         do not have opposite signs, `Cancelled`, or `MaxIterationsReached`.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_ksection_solver(WorkStealingPool& pool, SolverWorkspace& workspace, double leftBound,
+                                double rightBound, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                                Observer&& observer = Observer{}) {
+    SolverWorkspace::Scope scope(workspace);
+    const std::size_t interior = std::max<std::size_t>(pool.thread_count(), 1);
+    std::span<double> x = workspace.allocate_array<double>(interior + 2);
+    std::span<double> y = workspace.allocate_array<double>(interior + 2);
+    SolveResult result;
+
+    // Both ends in one round
+    x[0] = leftBound;
+    x[1] = rightBound;
+    detail::evaluate_points(pool, f, x.data(), y.data(), 2);
+    double a = leftBound, fa = y[0];
+    double b = rightBound, fb = y[1];
+    if (b < a) {
+        std::swap(a, b);
+        std::swap(fa, fb);
+    }
+    result.evaluations = 2;
+    result.root = b;
+    result.fRoot = fb;
+    if (fa * fb > 0) {
+        result.status = SolveStatus::InvalidBracket;
+        return result;
+    }
+
+    detail::start_table(observer, "ksection", {{"Iteration", 10}, {"a", 15}, {"b", 15}, {"p", 15}, {"f(p)", 15}});
+    bool clustered = false;
+    double estimate = 0, window = 0;
+    for (int i = 1; ; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+        bool leftBest = std::abs(fa) < std::abs(fb);
+        result.root = leftBest ? a : b;
+        result.fRoot = leftBest ? fa : fb;
+        if (b - a <= 2 * tolerance || result.fRoot == 0) {
+            observer.on_converged(result.root);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        if (i > maxIterations) {
+            break;
+        }
+
+        // Interior points: uniform over the bracket, except that a clustered round moves half of
+        // them (all of them with a single thread) into the window around the estimate
+        const std::size_t windowPoints = clustered ? interior - interior / 2 : 0;
+        const std::size_t spread = interior - windowPoints;
+        const double lo = std::max(a, estimate - window), hi = std::min(b, estimate + window);
+        for (std::size_t j = 0; j < spread; j++) {
+            x[1 + j] = a + (b - a) * static_cast<double>(j + 1) / static_cast<double>(spread + 1);
+        }
+        for (std::size_t j = 0; j < windowPoints; j++) {
+            x[1 + spread + j] = lo + (hi - lo) * static_cast<double>(j + 1) / static_cast<double>(windowPoints + 1);
+        }
+        std::sort(x.begin() + 1, x.begin() + 1 + static_cast<std::ptrdiff_t>(interior));
+        x[0] = a;
+        std::size_t count = 1;
+        for (std::size_t j = 1; j <= interior; j++) {
+            if (x[j] > x[count - 1] && x[j] < b) {
+                x[count++] = x[j];
+            }
+        }
+        x[count++] = b;
+        detail::evaluate_points(pool, f, x.data() + 1, y.data() + 1, count - 2);
+        y[0] = fa;
+        y[count - 1] = fb;
+        result.evaluations += static_cast<int>(count - 2);
+        result.iterations = i;
+
+        // Keep the first subinterval with a sign change (or an exact root)
+        std::size_t k = 0;
+        while (k + 2 < count && y[k] != 0 && y[k + 1] != 0 && detail::same_sign(y[k], y[k + 1])) {
+            k++;
+        }
+        if (y[k] == 0 || y[k + 1] == 0) {
+            std::size_t exact = y[k] == 0 ? k : k + 1;
+            result.root = x[exact];
+            result.fRoot = 0;
+            observer.on_converged(result.root);
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+        const double width = b - a;
+        a = x[k];
+        fa = y[k];
+        b = x[k + 1];
+        fb = y[k + 1];
+        detail::report_bracket(i, a, b, std::abs(fa) < std::abs(fb) ? a : b, std::abs(fa) < std::abs(fb) ? fa : fb,
+                               observer);
+
+        // A clustered round that did no better than uniform points would have missed the root with
+        // its window: spread the next round uniformly again
+        if (clustered && b - a > width / static_cast<double>(interior + 1)) {
+            clustered = false;
+            continue;
+        }
+
+        // Interpolate through the new bracket and the nearest gathered point outside it
+        double secant = b - fb * (b - a) / (fb - fa);
+        double iqi = std::numeric_limits<double>::quiet_NaN();
+        bool hasLeft = k > 0;
+        bool hasRight = k + 2 < count;
+        if (hasLeft || hasRight) {
+            std::size_t c = hasLeft && (!hasRight || a - x[k - 1] < x[k + 2] - b) ? k - 1 : k + 2;
+            iqi = detail::inverse_quadratic_estimate(a, fa, b, fb, x[c], y[c]);
+        }
+        if (iqi > a && iqi < b) {
+            estimate = iqi;
+            window = std::max(2 * std::abs(iqi - secant), tolerance);
+        } else {
+            estimate = secant;
+            window = (b - a) / static_cast<double>(interior + 1);
+        }
+        // Only worth it if the window is narrower than the subintervals of a uniform round
+        clustered = 2 * window < (b - a) / static_cast<double>(interior + 1);
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Finds the root of a function by parallel k-section with interpolation, without throwing.
+ *
+ * try_ksection_solver() with a workspace of its own.
+ */
+template <typename F, typename Observer = NullObserver>
+SolveResult try_ksection_solver(WorkStealingPool& pool, double leftBound, double rightBound, F&& f,
+                                double tolerance = 1e-6, int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    SolverWorkspace workspace(2 * (pool.thread_count() + 2) * sizeof(double) + 2 * SolverWorkspace::alignment);
+    return try_ksection_solver(pool, workspace, leftBound, rightBound, std::forward<F>(f), tolerance, maxIterations,
+                               std::forward<Observer>(observer));
+}
+
+/**
+ * @brief Finds the root of a function by parallel k-section with interpolation.
+ *
+ * Throwing form of try_ksection_solver().
+ *
+ * @return double The approximate root of the function `f` within the given interval.
+ * @throws std::invalid_argument If `f(leftBound)` and `f(rightBound)` do not have opposite signs.
+ * @throws std::runtime_error If the method fails to find a root within the given number of rounds.
+ */
+template <typename F, typename Observer = NullObserver>
+double ksection_solver(WorkStealingPool& pool, double leftBound, double rightBound, F&& f, double tolerance = 1e-6,
+                       int maxIterations = 1000000, Observer&& observer = Observer{}) {
+    SolveResult result = try_ksection_solver(pool, leftBound, rightBound, std::forward<F>(f), tolerance, maxIterations,
+                                             std::forward<Observer>(observer));
+    if (result.status == SolveStatus::InvalidBracket) {
+        throw std::invalid_argument("The algorithm requires the function values at the boundaries to be of opposite signs.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " rounds.");
+    }
+    return result.root;
+}
+
+#endif //KSECTION_SOLVER_H
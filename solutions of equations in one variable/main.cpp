@@ -14,6 +14,15 @@ double fixed_point_solver_test(double x) {
     return 0.5 * sqrt(10 - x*x*x);
 }
 
+// The same equation solved by the compiler: the templated solvers are constexpr with the default observer
+constexpr auto cubic = [](auto x) { return x*x*x + 4*x*x - 10; };
+constexpr double cubicRootBisection = bisection_solver(1, 2, cubic, 1e-9);
+constexpr double cubicRootNewton = newton_raphson_solver(1.5, cubic, 1e-12);
+constexpr double cubicRootSecant = secant_solver(1, 2, cubic, 1e-12);
+static_assert(cubicRootNewton > 1.3652300134 && cubicRootNewton < 1.3652300135);
+static_assert(cubicRootSecant - cubicRootNewton < 1e-12 && cubicRootNewton - cubicRootSecant < 1e-12);
+static_assert(cubicRootBisection - cubicRootNewton < 1e-9 && cubicRootNewton - cubicRootBisection < 1e-9);
+
 int main() {
     cout << "Considering the function x^3 - 4x^2 - 10" << endl;
     cout << "The iterations for bisection are as follow" << endl;
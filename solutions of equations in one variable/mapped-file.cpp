@@ -0,0 +1,275 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "mapped-file.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef _WIN32
+
+[[noreturn]] void fail(const std::string& what, const std::string& path) {
+    throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), what + " " + path);
+}
+
+std::size_t page_size() {
+    static const std::size_t size = [] {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<std::size_t>(info.dwPageSize);
+    }();
+    return size;
+}
+
+#else
+
+[[noreturn]] void fail(const std::string& what, const std::string& path) {
+    throw std::system_error(errno, std::generic_category(), what + " " + path);
+}
+
+std::size_t page_size() {
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+#endif
+
+} // namespace
+
+#ifdef _WIN32
+
+MappedFile MappedFile::open_read(const std::string& path) {
+    MappedFile file;
+    file.fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file.fileHandle == INVALID_HANDLE_VALUE) {
+        file.fileHandle = nullptr;
+        fail("Could not open", path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file.fileHandle, &size)) {
+        fail("Could not get the size of", path);
+    }
+    file.length = static_cast<std::size_t>(size.QuadPart);
+    if (file.length == 0) {
+        return file;
+    }
+    file.mappingHandle = CreateFileMappingA(file.fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (file.mappingHandle == nullptr) {
+        fail("Could not map", path);
+    }
+    file.address = static_cast<std::byte*>(MapViewOfFile(file.mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (file.address == nullptr) {
+        fail("Could not map", path);
+    }
+    return file;
+}
+
+MappedFile MappedFile::create(const std::string& path, std::size_t size) {
+    MappedFile file;
+    file.writable = true;
+    file.fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file.fileHandle == INVALID_HANDLE_VALUE) {
+        file.fileHandle = nullptr;
+        fail("Could not create", path);
+    }
+    file.length = size;
+    if (size == 0) {
+        return file;
+    }
+    const auto wide = static_cast<unsigned long long>(size);
+    file.mappingHandle = CreateFileMappingA(file.fileHandle, nullptr, PAGE_READWRITE, static_cast<DWORD>(wide >> 32),
+                                            static_cast<DWORD>(wide & 0xffffffffu), nullptr);
+    if (file.mappingHandle == nullptr) {
+        fail("Could not map", path);
+    }
+    file.address = static_cast<std::byte*>(MapViewOfFile(file.mappingHandle, FILE_MAP_WRITE, 0, 0, 0));
+    if (file.address == nullptr) {
+        fail("Could not map", path);
+    }
+    return file;
+}
+
+void MappedFile::close() {
+    if (address != nullptr) {
+        UnmapViewOfFile(address);
+    }
+    if (mappingHandle != nullptr) {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle != nullptr) {
+        CloseHandle(fileHandle);
+    }
+    address = nullptr;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+    length = 0;
+}
+
+void MappedFile::prefetch(std::size_t offset, std::size_t bytes) const {
+    if (address == nullptr || offset >= length) {
+        return;
+    }
+    WIN32_MEMORY_RANGE_ENTRY range{address + offset, std::min(bytes, length - offset)};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+void MappedFile::release(std::size_t offset, std::size_t bytes) const {
+    const std::size_t page = page_size();
+    const std::size_t begin = offset / page * page;
+    const std::size_t end = std::min(offset + bytes, length) / page * page;
+    if (address != nullptr && begin < end) {
+        // Unlocking pages that are not locked takes them out of the working set
+        VirtualUnlock(address + begin, end - begin);
+    }
+}
+
+void MappedFile::flush() const {
+    if (address != nullptr && writable) {
+        FlushViewOfFile(address, 0);
+        FlushFileBuffers(fileHandle);
+    }
+}
+
+#else
+
+MappedFile MappedFile::open_read(const std::string& path) {
+    MappedFile file;
+    file.descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file.descriptor < 0) {
+        fail("Could not open", path);
+    }
+    struct stat status;
+    if (fstat(file.descriptor, &status) != 0) {
+        fail("Could not get the size of", path);
+    }
+    file.length = static_cast<std::size_t>(status.st_size);
+    if (file.length == 0) {
+        return file;
+    }
+    void* address = mmap(nullptr, file.length, PROT_READ, MAP_SHARED, file.descriptor, 0);
+    if (address == MAP_FAILED) {
+        fail("Could not map", path);
+    }
+    file.address = static_cast<std::byte*>(address);
+    madvise(address, file.length, MADV_SEQUENTIAL);
+    return file;
+}
+
+MappedFile MappedFile::create(const std::string& path, std::size_t size) {
+    MappedFile file;
+    file.writable = true;
+    file.descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file.descriptor < 0) {
+        fail("Could not create", path);
+    }
+    if (ftruncate(file.descriptor, static_cast<off_t>(size)) != 0) {
+        fail("Could not resize", path);
+    }
+    file.length = size;
+    if (size == 0) {
+        return file;
+    }
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.descriptor, 0);
+    if (address == MAP_FAILED) {
+        fail("Could not map", path);
+    }
+    file.address = static_cast<std::byte*>(address);
+    return file;
+}
+
+void MappedFile::close() {
+    if (address != nullptr) {
+        munmap(address, length);
+    }
+    if (descriptor >= 0) {
+        ::close(descriptor);
+    }
+    address = nullptr;
+    descriptor = -1;
+    length = 0;
+}
+
+void MappedFile::prefetch(std::size_t offset, std::size_t bytes) const {
+    if (address == nullptr || offset >= length) {
+        return;
+    }
+    const std::size_t page = page_size();
+    const std::size_t begin = offset / page * page;
+    const std::size_t end = std::min(offset + bytes, length);
+    madvise(address + begin, end - begin, MADV_WILLNEED);
+}
+
+void MappedFile::release(std::size_t offset, std::size_t bytes) const {
+    const std::size_t page = page_size();
+    const std::size_t begin = offset / page * page;
+    const std::size_t end = std::min(offset + bytes, length) / page * page;
+    if (address == nullptr || begin >= end) {
+        return;
+    }
+    if (writable) {
+        // Start the write-back first; dropping a dirty page of a shared mapping keeps its contents
+        // in the page cache, this only keeps the dirty set from piling up until flush()
+        msync(address + begin, end - begin, MS_ASYNC);
+    }
+    madvise(address + begin, end - begin, MADV_DONTNEED);
+}
+
+void MappedFile::flush() const {
+    if (address != nullptr && writable) {
+        msync(address, length, MS_SYNC);
+    }
+}
+
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : address(std::exchange(other.address, nullptr)), length(std::exchange(other.length, 0)),
+      writable(other.writable),
+#ifdef _WIN32
+      fileHandle(std::exchange(other.fileHandle, nullptr)), mappingHandle(std::exchange(other.mappingHandle, nullptr)) {
+#else
+      descriptor(std::exchange(other.descriptor, -1)) {
+#endif
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        address = std::exchange(other.address, nullptr);
+        length = std::exchange(other.length, 0);
+        writable = other.writable;
+#ifdef _WIN32
+        fileHandle = std::exchange(other.fileHandle, nullptr);
+        mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#else
+        descriptor = std::exchange(other.descriptor, -1);
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
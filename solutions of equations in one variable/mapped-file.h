@@ -0,0 +1,71 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief A whole file mapped into memory, read-only or read-write (POSIX mmap, Win32 file mappings).
+ *
+ * The mapping reserves address space for the whole file, but pages are only read in when touched
+ * and can be handed back with release(), so a sequential pass over a file of any size keeps a
+ * constant resident set. Pages written through a read-write mapping go to the file; flush() waits
+ * for them to be written back instead of leaving it to the operating system.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief Maps an existing file read-only.
+     * @throws std::system_error If the file cannot be opened or mapped.
+     */
+    static MappedFile open_read(const std::string& path);
+
+    /**
+     * @brief Creates (or truncates) a file of `size` bytes and maps it read-write.
+     * @throws std::system_error If the file cannot be created, resized or mapped.
+     */
+    static MappedFile create(const std::string& path, std::size_t size);
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::byte* data() { return address; }
+    const std::byte* data() const { return address; }
+    std::size_t size() const { return length; }
+
+    // Asks the operating system to start reading [offset, offset + bytes) in the background.
+    void prefetch(std::size_t offset, std::size_t bytes) const;
+
+    // Drops the pages from the one holding `offset` up to the last one ending inside the range from
+    // the resident set, so a sequential pass releasing what it has done frees every page once.
+    // Written pages stay in the file. Dropped pages are read in again if touched later.
+    void release(std::size_t offset, std::size_t bytes) const;
+
+    // Writes every modified page back to the file.
+    void flush() const;
+
+private:
+    void close();
+
+    std::byte* address = nullptr;
+    std::size_t length = 0;
+    bool writable = false;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#else
+    int descriptor = -1;
+#endif
+};
+
+#endif //MAPPED_FILE_H
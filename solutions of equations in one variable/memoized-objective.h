@@ -0,0 +1,163 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef MEMOIZED_OBJECTIVE_H
+#define MEMOIZED_OBJECTIVE_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Memoization of expensive objectives.
+//
+// The solvers evaluate every point they visit once, but callers often run several solves over the
+// same points: a bracket search followed by a solve on the bracket, the same equation retried with
+// another method, or a fixed-point iteration that revisits its iterates. MemoizedObjective keeps the
+// most recent evaluations in a small open-addressing table keyed on the exact bits of x, so each of
+// those repeated points costs a lookup instead of an evaluation of f.
+//
+//     auto f = memoize([](double x) { return expensive(x); });
+//     try_brent_solver(0.0, 1.0, f);
+//     try_brent_solver(0.0, 1.0, f);        // answered from the cache
+//     std::cout << f.hits() << " hits, " << f.misses() << " misses\n";
+//
+// Only evaluations on doubles are cached; evaluations on dual numbers, Taylor jets or complex
+// arguments (exact derivatives, see derivative-policies.h) are forwarded to f unchanged.
+
+// Default number of entries of a MemoizedObjective.
+inline constexpr std::size_t memoizedObjectiveCapacity = 256;
+
+/**
+ * @brief f with a bounded cache of its values, keyed on the bits of the argument.
+ *
+ * The table has a power-of-two number of slots and is searched by linear probing over at most
+ * `maxProbe` slots from the hashed position. When all of them are taken, the entry at the hashed
+ * position is replaced, so the memory use stays fixed however many points are evaluated. Keys
+ * compare bit for bit: 0.0 and -0.0 are different points, and a NaN argument is cached like any
+ * other.
+ *
+ * f is stored by value (wrap it in std::ref to keep a reference). The cache is not synchronized;
+ * use one MemoizedObjective per thread.
+ */
+template <typename F>
+class MemoizedObjective {
+public:
+    // Slots probed from the hashed position before an entry is replaced.
+    static constexpr std::size_t maxProbe = 8;
+
+    /**
+     * @param f The function to memoize.
+     * @param capacity The number of entries kept, rounded up to a power of two of at least maxProbe.
+     */
+    explicit MemoizedObjective(F f, std::size_t capacity = memoizedObjectiveCapacity)
+        : function(std::move(f)), slots(std::bit_ceil(std::max(capacity, maxProbe))),
+          shift(64 - std::countr_zero(slots.size())) {}
+
+    // f(x), from the cache when x has been evaluated before.
+    double operator()(double x) {
+        std::uint64_t key = std::bit_cast<std::uint64_t>(x);
+        std::size_t mask = slots.size() - 1;
+        std::size_t home = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> shift);
+        for (std::size_t probe = 0; probe < maxProbe; probe++) {
+            Slot& slot = slots[(home + probe) & mask];
+            if (!slot.used) {
+                slot = {key, function(x), true};
+                missCount++;
+                entries++;
+                return slot.value;
+            }
+            if (slot.key == key) {
+                hitCount++;
+                return slot.value;
+            }
+        }
+        // Entries are replaced but never removed, so the probe sequences of the others stay intact
+        double y = function(x);
+        slots[home] = {key, y, true};
+        missCount++;
+        return y;
+    }
+
+    // f on a non-arithmetic argument (dual number, jet, complex), not cached.
+    template <typename X>
+        requires (!std::is_arithmetic_v<X>)
+    auto operator()(X x) -> decltype(std::declval<F&>()(x)) {
+        return function(x);
+    }
+
+    // Evaluations answered from the cache.
+    std::size_t hits() const { return hitCount; }
+
+    // Evaluations of f on doubles, which is also the number of cached evaluations ever made.
+    std::size_t misses() const { return missCount; }
+
+    // Entries currently cached.
+    std::size_t size() const { return entries; }
+
+    std::size_t capacity() const { return slots.size(); }
+
+    // Forgets every cached value and resets the counters.
+    void clear() {
+        std::fill(slots.begin(), slots.end(), Slot{});
+        hitCount = missCount = entries = 0;
+    }
+
+private:
+    struct Slot {
+        std::uint64_t key = 0;
+        double value = 0;
+        bool used = false;
+    };
+
+    F function;
+    std::vector<Slot> slots;
+    int shift;
+    std::size_t hitCount = 0;
+    std::size_t missCount = 0;
+    std::size_t entries = 0;
+};
+
+/**
+ * @brief Wraps f in a MemoizedObjective with `capacity` entries.
+ */
+template <typename F>
+MemoizedObjective<std::decay_t<F>> memoize(F&& f, std::size_t capacity = memoizedObjectiveCapacity) {
+    return MemoizedObjective<std::decay_t<F>>(std::forward<F>(f), capacity);
+}
+
+namespace detail {
+
+// f answering from known values at the two ends x0, x1 of a bracket, for solves started on a
+// bracket whose end values the caller has already computed. The solver still counts the two
+// lookups as evaluations; callers subtract them. Dual-number and Taylor-jet calls go to f, so
+// derivative-based solvers keep their exact derivatives.
+template <typename F>
+struct KnownEndpoints {
+    F& f;
+    double x0, y0, x1, y1;
+
+    double operator()(double x) const {
+        if (x == x0) {
+            return y0;
+        }
+        if (x == x1) {
+            return y1;
+        }
+        return f(x);
+    }
+
+    template <typename T>
+        requires (!std::is_same_v<std::remove_cvref_t<T>, double> && std::is_invocable_v<F&, T>)
+    auto operator()(T&& x) const -> std::invoke_result_t<F&, T> {
+        return f(std::forward<T>(x));
+    }
+};
+
+} // namespace detail
+
+#endif //MEMOIZED_OBJECTIVE_H
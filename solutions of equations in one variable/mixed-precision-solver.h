@@ -0,0 +1,208 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef MIXED_PRECISION_SOLVER_H
+#define MIXED_PRECISION_SOLVER_H
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "batch-solvers.h"
+#include "double-double.h"
+#include "dual.h"
+#include "equations-solver.h"
+
+// Mixed-precision batch Newton: most of the work in float, double accuracy at the end, and
+// double-double only where double arithmetic cannot resolve the root.
+//
+// A problem goes through up to four stages:
+//   1. Newton in float lanes, twice as many per block as the double engines (batch-solvers.h), so a
+//      vector register holds twice the problems;
+//   2. promotion to double and a fixed number (1-2) of Newton refinement steps, which take a float
+//      approximation to double accuracy for a simple root;
+//   3. a residual check in double: the lane is accepted when the next Newton correction is below
+//      `tolerance` relative to the root, |f(x)| <= tolerance·|f'(x)|·max(1, |x|);
+//   4. Newton in DoubleDouble for the lanes that failed the check, typically roots that are
+//      ill-conditioned in double (near-double roots of an expanded polynomial, where rounding in f
+//      swamps f' and the correction never settles).
+// The MixedPrecisionReport gives the number of lanes that reached each stage.
+//
+// Stages 1 to 3 are branch-free lane loops like those of batch-solvers.h; the float lanes blend
+// with 32-bit masks, the width of a float, so that a vector register does hold twice the lanes.
+// With a generic objective that inlines, GCC 12 at -O3 -march=x86-64-v3 vectorizes the float
+// Newton loop, the refinement and the residual check (-fopt-info-vec).
+//
+// The objective is called as `f(i, x)` with x of type float, double and DoubleDouble (and Dual of
+// those for exact derivatives), so it has to be generic and do its arithmetic in the type of x; a
+// coefficient stored as double is converted explicitly, otherwise float lanes compute in double:
+//
+//     auto quadratic = [&]<typename T>(std::size_t i, T x) { return (x - T(a[i])) * x + T(b[i]); };
+
+struct MixedPrecisionOptions {
+    double tolerance = 1e-12;       // relative Newton correction accepted by the residual check
+    float floatTolerance = 1e-5f;   // float stage stops when |p - p0| < floatTolerance·max(1, |p|)
+    int floatIterations = 50;
+    int refinementSteps = 2;
+    int escalationIterations = 20;  // Newton iterations in DoubleDouble per escalated lane
+};
+
+// Lanes per stage of a mixed-precision solve.
+struct MixedPrecisionReport {
+    std::size_t floatConverged = 0;             // lanes whose float stage converged
+    std::size_t acceptedAfterRefinement = 0;    // lanes that passed the residual check in double
+    std::size_t escalated = 0;                  // lanes handed to the DoubleDouble stage
+    std::size_t escalatedConverged = 0;         // of those, lanes that converged in DoubleDouble
+    std::size_t converged = 0;                  // acceptedAfterRefinement + escalatedConverged
+};
+
+namespace detail {
+
+// Lane masks of the float stage, all bits set for true
+using FloatLaneMask = std::int32_t;
+
+inline FloatLaneMask float_lane_mask(bool condition) {
+    return -static_cast<FloatLaneMask>(condition);
+}
+
+// mask ? a : b with both operands evaluated, without a branch
+inline float select(FloatLaneMask mask, float a, float b) {
+    return std::bit_cast<float>((std::bit_cast<FloatLaneMask>(a) & mask) | (std::bit_cast<FloatLaneMask>(b) & ~mask));
+}
+
+// f(i, x) and f'(i, x) in T: exact on Dual<T> when f is generic, otherwise a central difference
+// with step eps^(1/3)·max(|x|, 1) of T.
+template <typename T, typename F>
+BasicValueAndDerivative<T> lane_value_and_derivative(F& f, std::size_t i, T x) {
+    if constexpr (requires { { f(i, Dual<T>::variable(x)) } -> std::same_as<Dual<T>>; }) {
+        Dual<T> y = f(i, Dual<T>::variable(x));
+        return {y.value, y.derivative, 1};
+    } else {
+        using std::abs;
+        T h = T(std::cbrt(static_cast<double>(std::numeric_limits<T>::epsilon()))) * (abs(x) > T(1) ? abs(x) : T(1));
+        return {T(f(i, x)), T((T(f(i, x + h)) - T(f(i, x - h))) / (2 * h)), 3};
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Mixed-precision Newton-Raphson method: solves `f(i, x) = 0` from initialPoints[i] for every i.
+ *
+ * Runs float Newton on blocks of 2·batchLaneWidth lanes, refines every lane in double, and escalates
+ * the lanes failing the residual check to a per-lane try_newton_raphson_solver<DoubleDouble>() (see
+ * the comment at the top of this file). Roots are stored rounded to double. A lane is reported
+ * `Converged` when it passed the residual check or its DoubleDouble solve converged; otherwise it
+ * keeps the status of its DoubleDouble solve (`ZeroDerivative` or `MaxIterationsReached`). `iterations`
+ * counts the iterations of all stages of the lane.
+ *
+ * @param initialPoints The initial estimates.
+ * @param f The objective, called as `f(i, x)` with float, double and DoubleDouble arguments.
+ * @param results Where roots, statuses and (optionally) iteration counts are stored.
+ * @param options Tolerances and per-stage iteration limits.
+ * @return MixedPrecisionReport The number of lanes that reached each stage.
+ * @throws std::invalid_argument If the spans do not all have the same size.
+ */
+template <std::size_t Lanes = 2 * batchLaneWidth, typename F>
+MixedPrecisionReport mixed_precision_newton_solver(std::span<const double> initialPoints, F&& f, const BatchResults& results,
+                                                   const MixedPrecisionOptions& options = {}) {
+    const std::size_t count = initialPoints.size();
+    detail::check_batch_sizes(count, count, results);
+
+    MixedPrecisionReport report;
+    for (std::size_t base = 0; base < count; base += Lanes) {
+        std::size_t index[Lanes];
+        std::size_t lanes = detail::load_block_indices(base, count, index);
+
+        // Stage 1: float lanes
+        float x[Lanes];
+        detail::FloatLaneMask active[Lanes], floatConverged[Lanes];
+        int iterations[Lanes];
+        for (std::size_t l = 0; l < Lanes; l++) {
+            x[l] = static_cast<float>(initialPoints[index[l]]);
+            active[l] = detail::float_lane_mask(true);
+            floatConverged[l] = 0;
+            iterations[l] = 0;
+        }
+        for (int i = 1; i <= options.floatIterations && detail::any_lane(active); i++) {
+            for (std::size_t l = 0; l < Lanes; l++) {
+                BasicValueAndDerivative<float> y = detail::lane_value_and_derivative(f, index[l], x[l]);
+                detail::FloatLaneMask zeroDerivative = detail::float_lane_mask(y.derivative == 0);
+                float p = x[l] - y.value / detail::select(zeroDerivative, 1.0f, y.derivative);
+                // isfinite(p) and max(1, |p|), written so that GCC does not turn them into branches
+                float size = std::abs(p);
+                detail::FloatLaneMask finite = detail::float_lane_mask(size <= std::numeric_limits<float>::max());
+                float scale = detail::select(detail::float_lane_mask(size > 1.0f), size, 1.0f);
+                detail::FloatLaneMask step = active[l] & ~zeroDerivative & finite;
+                detail::FloatLaneMask stop = step & detail::float_lane_mask(std::abs(p - x[l])
+                                                                            < options.floatTolerance * scale);
+
+                iterations[l] += step & 1;
+                floatConverged[l] |= stop;
+                x[l] = detail::select(step, p, x[l]);
+                active[l] = step & ~stop;
+            }
+        }
+
+        // Stages 2 and 3: refinement and residual check in double. A lane whose float stage failed
+        // is refined from its float iterate all the same; it normally fails the check and escalates.
+        double root[Lanes];
+        detail::LaneMask accepted[Lanes];
+        for (std::size_t l = 0; l < Lanes; l++) {
+            root[l] = static_cast<double>(x[l]);
+        }
+        for (int i = 0; i < options.refinementSteps; i++) {
+            for (std::size_t l = 0; l < Lanes; l++) {
+                ValueAndDerivative y = detail::lane_value_and_derivative(f, index[l], root[l]);
+                detail::LaneMask zeroDerivative = detail::lane_mask(y.derivative == 0);
+                double p = root[l] - y.value / detail::select(zeroDerivative, 1.0, y.derivative);
+                detail::LaneMask finite = detail::lane_mask(std::abs(p) <= std::numeric_limits<double>::max());
+                detail::LaneMask step = ~zeroDerivative & finite;
+                root[l] = detail::select(step, p, root[l]);
+                iterations[l] += static_cast<int>(~zeroDerivative & 1);
+            }
+        }
+        for (std::size_t l = 0; l < Lanes; l++) {
+            ValueAndDerivative y = detail::lane_value_and_derivative(f, index[l], root[l]);
+            double size = std::abs(root[l]);
+            double scale = detail::select(detail::lane_mask(size > 1.0), size, 1.0);
+            accepted[l] = detail::lane_mask(std::abs(y.value) <= options.tolerance * std::abs(y.derivative) * scale);
+        }
+
+        // Stage 4: DoubleDouble, one lane at a time since few lanes get here
+        for (std::size_t l = 0; l < lanes; l++) {
+            const std::size_t problem = base + l;
+            report.floatConverged += floatConverged[l] != 0;
+            SolveStatus status = SolveStatus::Converged;
+            if (accepted[l]) {
+                report.acceptedAfterRefinement++;
+            } else {
+                report.escalated++;
+                auto g = [&](auto y) -> decltype(f(problem, y)) { return f(problem, y); };
+                BasicSolveResult<DoubleDouble> escalated = try_newton_raphson_solver<DoubleDouble>(
+                    root[l], g, options.tolerance * std::max(1.0, std::abs(root[l])), options.escalationIterations);
+                iterations[l] += escalated.iterations;
+                status = escalated.status;
+                if (escalated.converged()) {
+                    report.escalatedConverged++;
+                    root[l] = static_cast<double>(escalated.root);
+                }
+            }
+            results.roots[problem] = root[l];
+            results.status[problem] = status;
+            if (!results.iterations.empty()) {
+                results.iterations[problem] = iterations[l];
+            }
+        }
+    }
+    report.converged = report.acceptedAfterRefinement + report.escalatedConverged;
+    return report;
+}
+
+#endif //MIXED_PRECISION_SOLVER_H
@@ -0,0 +1,445 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef POLYNOMIAL_H
+#define POLYNOMIAL_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bracketing-solvers.h"
+#include "derivative-policies.h"
+#include "solver-error.h"
+
+// Polynomials as objectives. A Polynomial is a callable, so every template solver accepts it in
+// place of a function (`newton_raphson_solver(1.5, p)`), and it is evaluated with Horner's scheme,
+// one fused multiply-add per coefficient, instead of through an opaque function pointer. Newton-type
+// solvers get p and p' from a single Horner pass through value_and_derivative(), which
+// AutomaticDerivative picks up; the generic call operator also works on dual numbers, Taylor jets and
+// std::complex, so the other derivative policies and the higher-order solvers apply as well.
+//
+// On top of that, newton_deflation_solver() finds every real root and aberth_solver() every complex
+// root of a polynomial.
+
+// Degree parameter of a Polynomial whose degree is only known at run time.
+inline constexpr std::size_t dynamicDegree = std::numeric_limits<std::size_t>::max();
+
+namespace detail {
+
+template <std::size_t N>
+struct PolynomialStorage {
+    using type = std::array<double, N + 1>;
+};
+
+template <>
+struct PolynomialStorage<dynamicDegree> {
+    using type = std::vector<double>;
+};
+
+// p(x) and p'(x) in one Horner pass over the coefficients c[0] + c[1] x + ... (c must not be empty).
+// `bound` receives a bound on the rounding error of p(x).
+inline ValueAndDerivative horner(std::span<const double> c, double x, double& bound) {
+    std::size_t n = c.size() - 1;
+    double p = c[n], d = 0, magnitude = std::abs(c[n]);
+    double ax = std::abs(x);
+    for (std::size_t k = n; k-- > 0;) {
+        d = std::fma(d, x, p);
+        p = std::fma(p, x, c[k]);
+        magnitude = std::fma(magnitude, ax, std::abs(c[k]));
+    }
+    bound = 2 * static_cast<double>(n + 1) * std::numeric_limits<double>::epsilon() * magnitude;
+    return {p, d, 1};
+}
+
+// Divides c (degree n) by (x - root) in place; the quotient ends up in c[0 .. n - 1].
+inline void deflate_in_place(std::span<double> c, double root) {
+    std::size_t n = c.size() - 1;
+    double carry = c[n];
+    for (std::size_t k = n; k-- > 0;) {
+        double next = c[k];
+        c[k] = carry;
+        carry = std::fma(carry, root, next);
+    }
+}
+
+// Newton-Raphson on the polynomial c from x. Stops when the step is below tolerance·max(|x|, 1)
+// or |p(x)| is within the rounding error of its evaluation, which keeps multiple roots from
+// wandering in the noise.
+inline bool polynomial_newton(std::span<const double> c, double& x, double tolerance, int maxIterations) {
+    for (int i = 1; i <= maxIterations; i++) {
+        double bound;
+        ValueAndDerivative y = horner(c, x, bound);
+        if (std::abs(y.value) <= bound) {
+            return true;
+        }
+        if (y.derivative == 0 || !std::isfinite(y.value)) {
+            return false;
+        }
+        double step = y.value / y.derivative;
+        x -= step;
+        if (std::abs(step) < scaled_step(x, tolerance)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Copies the coefficients without the zero leading ones, and strips the roots at zero (the zero
+// trailing coefficients) into `zeroRoots`.
+inline std::vector<double> trimmed_coefficients(std::span<const double> c, std::size_t& zeroRoots) {
+    std::size_t end = c.size();
+    while (end > 0 && c[end - 1] == 0) {
+        end--;
+    }
+    if (end == 0) {
+        throw std::invalid_argument("The zero polynomial has no isolated roots.");
+    }
+    std::size_t begin = 0;
+    while (c[begin] == 0) {
+        begin++;
+    }
+    zeroRoots = begin;
+    return {c.begin() + static_cast<std::ptrdiff_t>(begin), c.begin() + static_cast<std::ptrdiff_t>(end)};
+}
+
+// Fujiwara's bound 2·max |c_(n-k) / c_n|^(1/k) on the magnitude of the roots of c (degree n ≥ 1).
+inline double fujiwara_bound(std::span<const double> c) {
+    std::size_t n = c.size() - 1;
+    double bound = 0;
+    for (std::size_t k = 1; k <= n; k++) {
+        double ratio = std::abs(c[n - k] / c[n]);
+        if (k == n) {
+            ratio /= 2;
+        }
+        bound = std::max(bound, std::pow(ratio, 1.0 / static_cast<double>(k)));
+    }
+    return 2 * bound;
+}
+
+// A real root and its multiplicity.
+struct RealRoot {
+    double x;
+    std::size_t multiplicity;
+};
+
+// The distinct real roots of c (degree n ≥ 1), ascending. p is monotone between consecutive
+// critical points, the real roots of p' found the same way, so each of those intervals with a sign
+// change holds exactly one simple root, refined by Chandrupatla's method. A critical point where |p|
+// is within rounding error is a multiple root, one more times than it is a root of p'. Only a root
+// whose sign change drowns in the rounding of p can be missed.
+inline std::vector<RealRoot> real_roots_between_critical_points(std::span<const double> c, double tolerance,
+                                                                int maxIterations) {
+    std::size_t n = c.size() - 1;
+    if (n == 1) {
+        return {{-c[0] / c[1], 1}};
+    }
+    std::vector<double> derivative(n);
+    for (std::size_t k = 1; k <= n; k++) {
+        derivative[k - 1] = static_cast<double>(k) * c[k];
+    }
+    // The critical points lie in the hull of the roots, inside the bound
+    double bound = fujiwara_bound(c);
+    std::vector<RealRoot> points = real_roots_between_critical_points(derivative, tolerance, maxIterations);
+    points.insert(points.begin(), {-bound, 0});
+    points.push_back({bound, 0});
+
+    std::vector<double> values(points.size());
+    std::vector<char> zero(points.size());
+    for (std::size_t k = 0; k < points.size(); k++) {
+        double error;
+        values[k] = horner(c, points[k].x, error).value;
+        zero[k] = std::abs(values[k]) <= error;
+    }
+    auto p = [c](double x) {
+        double error;
+        return horner(c, x, error).value;
+    };
+    std::vector<RealRoot> roots;
+    for (std::size_t k = 0; k < points.size(); k++) {
+        if (zero[k]) {
+            roots.push_back({points[k].x, points[k].multiplicity + 1});
+        } else if (k + 1 < points.size() && !zero[k + 1] && !same_sign(values[k], values[k + 1])) {
+            double scale = std::max({std::abs(points[k].x), std::abs(points[k + 1].x), 1.0});
+            SolveResult result = try_chandrupatla_solver(KnownBracket{points[k].x, values[k], points[k + 1].x,
+                                                                      values[k + 1]},
+                                                         p, tolerance * scale, maxIterations);
+            roots.push_back({result.root, 1});
+        }
+    }
+    return roots;
+}
+
+} // namespace detail
+
+/**
+ * @brief Polynomial c[0] + c[1] x + ... + c[N] x^N with real coefficients.
+ *
+ * With a degree N the coefficients live in a std::array; with the default `dynamicDegree` they live
+ * in a std::vector and the degree is set at run time. Coefficients are given lowest order first:
+ *
+ *     Polynomial<3> p{-10, 0, 4, 1};     // x^3 + 4x^2 - 10, the func_test of main.cpp
+ *     Polynomial<> q{-10, 0, 4, 1};      // the same with a dynamic degree
+ */
+template <std::size_t N = dynamicDegree>
+struct Polynomial {
+    typename detail::PolynomialStorage<N>::type coefficients{};
+
+    constexpr Polynomial() = default;
+
+    /**
+     * @param coefficients The coefficients, lowest order first; for a fixed degree missing
+     *        high-order coefficients are zero.
+     * @throws std::invalid_argument If more than N + 1 coefficients are given for a fixed degree N.
+     */
+    Polynomial(std::initializer_list<double> coefficients) {
+        if constexpr (N == dynamicDegree) {
+            this->coefficients.assign(coefficients.begin(), coefficients.end());
+        } else {
+            if (coefficients.size() > N + 1) {
+                throw std::invalid_argument("A polynomial of degree " + std::to_string(N) + " has at most "
+                                            + std::to_string(N + 1) + " coefficients.");
+            }
+            std::copy(coefficients.begin(), coefficients.end(), this->coefficients.begin());
+        }
+    }
+
+    // The nominal degree, i.e. the number of coefficients minus one (leading zeros included).
+    std::size_t degree() const { return coefficients.empty() ? 0 : coefficients.size() - 1; }
+
+    // p(x) by Horner's scheme with fused multiply-adds.
+    double operator()(double x) const {
+        if (coefficients.empty()) {
+            return 0;
+        }
+        std::size_t n = coefficients.size() - 1;
+        double p = coefficients[n];
+        for (std::size_t k = n; k-- > 0;) {
+            p = std::fma(p, x, coefficients[k]);
+        }
+        return p;
+    }
+
+    // p(x) for other argument types: dual numbers, Taylor jets, std::complex.
+    template <typename T> requires (!std::is_arithmetic_v<T>)
+    T operator()(const T& x) const {
+        if (coefficients.empty()) {
+            return T(0.0);
+        }
+        std::size_t n = coefficients.size() - 1;
+        T p = T(coefficients[n]);
+        for (std::size_t k = n; k-- > 0;) {
+            p = p * x + coefficients[k];
+        }
+        return p;
+    }
+
+    // p(x) and p'(x) from one Horner pass, counted as a single evaluation.
+    ValueAndDerivative value_and_derivative(double x) const {
+        if (coefficients.empty()) {
+            return {0, 0, 1};
+        }
+        double bound;
+        return detail::horner(coefficients, x, bound);
+    }
+};
+
+/**
+ * @brief Divides a polynomial by (x - root), dropping the remainder.
+ *
+ * @return The quotient, of degree N - 1 (or dynamic).
+ */
+template <std::size_t N> requires (N == dynamicDegree || N >= 1)
+Polynomial<N == dynamicDegree ? dynamicDegree : N - 1> deflate(const Polynomial<N>& polynomial, double root) {
+    std::vector<double> c(polynomial.coefficients.begin(), polynomial.coefficients.end());
+    Polynomial<N == dynamicDegree ? dynamicDegree : N - 1> quotient;
+    if (c.size() < 2) {
+        return quotient;
+    }
+    detail::deflate_in_place(c, root);
+    if constexpr (N == dynamicDegree) {
+        quotient.coefficients.assign(c.begin(), c.end() - 1);
+    } else {
+        std::copy(c.begin(), c.end() - 1, quotient.coefficients.begin());
+    }
+    return quotient;
+}
+
+/**
+ * @brief Finds the real roots of a polynomial by Newton's method with deflation.
+ *
+ * Newton-Raphson is started from Fujiwara's bound on the roots of the current factor, to the right
+ * of all its real roots, where it converges monotonically to the largest one when all roots are
+ * real. The root is polished by Newton on the original polynomial, to remove the error accumulated by
+ * previous deflations, then divided out.
+ *
+ * Complex roots can stop Newton short of the real ones. If it fails on a factor, the real roots are
+ * instead isolated on the original polynomial, between its critical points (found recursively the
+ * same way), and refined by a bracketing method, which misses none but those lost in rounding. The
+ * complex roots are left to aberth_solver(). Multiple roots are returned once per multiplicity, with
+ * the reduced accuracy inherent to them.
+ *
+ * @param polynomial The polynomial whose real roots are sought.
+ * @param tolerance Newton stops when the step is below tolerance·max(|x|, 1).
+ * @param maxIterations The maximum number of Newton iterations per root.
+ * @return std::vector<double> The real roots in ascending order.
+ * @throws std::invalid_argument If all coefficients are zero.
+ */
+template <std::size_t N>
+std::vector<double> newton_deflation_solver(const Polynomial<N>& polynomial, double tolerance = 1e-12,
+                                            int maxIterations = 100) {
+    std::size_t zeroRoots;
+    std::vector<double> work = detail::trimmed_coefficients(polynomial.coefficients, zeroRoots);
+    const std::vector<double> original = work;
+    std::vector<double> roots(zeroRoots, 0.0);
+
+    while (work.size() > 1) {
+        std::size_t n = work.size() - 1;
+        double x;
+        if (n == 1) {
+            x = -work[0] / work[1];
+        } else {
+            x = detail::fujiwara_bound(work);
+            if (!detail::polynomial_newton(work, x, tolerance, maxIterations)) {
+                roots.assign(zeroRoots, 0.0);
+                for (detail::RealRoot root : detail::real_roots_between_critical_points(original, tolerance,
+                                                                                        maxIterations)) {
+                    roots.insert(roots.end(), root.multiplicity, root.x);
+                }
+                break;
+            }
+        }
+        double polished = x;
+        if (detail::polynomial_newton(original, polished, tolerance, maxIterations)) {
+            x = polished;
+        }
+        roots.push_back(x);
+        detail::deflate_in_place(work, x);
+        work.pop_back();
+    }
+    std::sort(roots.begin(), roots.end());
+    return roots;
+}
+
+/**
+ * @brief Finds all complex roots of a polynomial with the Aberth-Ehrlich method.
+ *
+ * All roots are refined simultaneously: every iteration moves each approximation z_i by the Newton
+ * correction w_i = p(z_i) / p'(z_i), damped by the repulsion of the others,
+ * z_i -= w_i / (1 - w_i Σ_{j≠i} 1 / (z_i - z_j)). It converges cubically to simple roots from the
+ * usual start on a circle of radius |c_0 / c_n|^(1/n). A root is frozen once its correction is below
+ * tolerance·max(|z_i|, 1) or |p(z_i)| is within rounding error.
+ *
+ * The approximations are kept as separate arrays of real and imaginary parts. The Horner pass, which
+ * dominates the cost, runs over the coefficients on the outside and all roots on the inside, so the
+ * compiler vectorizes it across roots; the corrections that follow are applied root by root
+ * (Gauss-Seidel), each one seeing the roots already corrected in the same iteration.
+ *
+ * @param polynomial The polynomial whose roots are sought.
+ * @param tolerance The convergence criterion of every root.
+ * @param maxIterations The maximum number of simultaneous iterations.
+ * @return std::vector<std::complex<double>> The n roots, ordered by real part, then imaginary part.
+ * @throws std::invalid_argument If all coefficients are zero.
+ * @throws std::runtime_error If the roots have not all converged after maxIterations iterations.
+ */
+template <std::size_t N>
+std::vector<std::complex<double>> aberth_solver(const Polynomial<N>& polynomial, double tolerance = 1e-12,
+                                                int maxIterations = 100) {
+    std::size_t zeroRoots;
+    const std::vector<double> c = detail::trimmed_coefficients(polynomial.coefficients, zeroRoots);
+    const std::size_t n = c.size() - 1;
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+
+    std::vector<double> re(n), im(n), pRe(n), pIm(n), dRe(n), dIm(n), magnitude(n);
+    std::vector<char> active(n, 1);
+    double radius = n > 0 ? std::pow(std::abs(c[0] / c[n]), 1.0 / static_cast<double>(n)) : 0;
+    for (std::size_t i = 0; i < n; i++) {
+        double angle = 2 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(n) + 0.4;
+        re[i] = radius * std::cos(angle);
+        im[i] = radius * std::sin(angle);
+    }
+
+    std::size_t remaining = n;
+    for (int iteration = 1; iteration <= maxIterations && remaining > 0; iteration++) {
+        // p(z_i), p'(z_i) and the error bound of p(z_i) for all roots at once
+        for (std::size_t i = 0; i < n; i++) {
+            pRe[i] = c[n]; pIm[i] = 0;
+            dRe[i] = 0; dIm[i] = 0;
+            magnitude[i] = std::abs(c[n]);
+        }
+        for (std::size_t k = n; k-- > 0;) {
+            for (std::size_t i = 0; i < n; i++) {
+                double zRe = re[i], zIm = im[i];
+                double newDRe = dRe[i] * zRe - dIm[i] * zIm + pRe[i];
+                double newDIm = dRe[i] * zIm + dIm[i] * zRe + pIm[i];
+                double newPRe = pRe[i] * zRe - pIm[i] * zIm + c[k];
+                double newPIm = pRe[i] * zIm + pIm[i] * zRe;
+                dRe[i] = newDRe; dIm[i] = newDIm;
+                pRe[i] = newPRe; pIm[i] = newPIm;
+                magnitude[i] = magnitude[i] * std::sqrt(zRe * zRe + zIm * zIm) + std::abs(c[k]);
+            }
+        }
+
+        // Aberth correction of every active root; later roots already see the corrected earlier ones
+        for (std::size_t i = 0; i < n; i++) {
+            if (!active[i]) {
+                continue;
+            }
+            double sRe = 0, sIm = 0;
+            for (std::size_t j = 0; j < n; j++) {
+                double xRe = re[i] - re[j], xIm = im[i] - im[j];
+                double norm = xRe * xRe + xIm * xIm;
+                double scale = j == i || norm == 0 ? 0.0 : 1 / norm;
+                sRe += xRe * scale;
+                sIm -= xIm * scale;
+            }
+            double dNorm = dRe[i] * dRe[i] + dIm[i] * dIm[i];
+            double pAbs = std::sqrt(pRe[i] * pRe[i] + pIm[i] * pIm[i]);
+            if (pAbs <= 4 * static_cast<double>(n + 1) * eps * magnitude[i] || dNorm == 0) {
+                active[i] = 0;
+                remaining--;
+                continue;
+            }
+            // w = p / p'
+            double wRe = (pRe[i] * dRe[i] + pIm[i] * dIm[i]) / dNorm;
+            double wIm = (pIm[i] * dRe[i] - pRe[i] * dIm[i]) / dNorm;
+            // correction = w / (1 - w s)
+            double qRe = 1 - (wRe * sRe - wIm * sIm);
+            double qIm = -(wRe * sIm + wIm * sRe);
+            double qNorm = qRe * qRe + qIm * qIm;
+            double cRe = qNorm == 0 ? wRe : (wRe * qRe + wIm * qIm) / qNorm;
+            double cIm = qNorm == 0 ? wIm : (wIm * qRe - wRe * qIm) / qNorm;
+            re[i] -= cRe;
+            im[i] -= cIm;
+            if (std::sqrt(cRe * cRe + cIm * cIm) < detail::scaled_step(std::sqrt(re[i] * re[i] + im[i] * im[i]), tolerance)) {
+                active[i] = 0;
+                remaining--;
+            }
+        }
+    }
+    if (remaining > 0) {
+        throw SolverError(SolveStatus::MaxIterationsReached, "No solution found after ", maxIterations, " iterations.");
+    }
+
+    std::vector<std::complex<double>> roots(zeroRoots, 0.0);
+    for (std::size_t i = 0; i < n; i++) {
+        roots.emplace_back(re[i], im[i]);
+    }
+    std::sort(roots.begin(), roots.end(), [](std::complex<double> x, std::complex<double> y) {
+        return x.real() < y.real() || (x.real() == y.real() && x.imag() < y.imag());
+    });
+    return roots;
+}
+
+#endif //POLYNOMIAL_H
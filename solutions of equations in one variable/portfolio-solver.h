@@ -0,0 +1,195 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef PORTFOLIO_SOLVER_H
+#define PORTFOLIO_SOLVER_H
+
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+#include "accelerated-solvers.h"
+#include "bracketing-solvers.h"
+#include "equations-solver.h"
+#include "solve-result.h"
+#include "solver-observers.h"
+#include "work-stealing-pool.h"
+
+// Portfolio ("racing") solve: runs several methods on the same problem at once, one thread each, and
+// keeps the first one that converges. The others are cancelled through a shared std::stop_source
+// that their CancellationObserver checks at the start of every iteration, so the latency of a solve
+// is that of the fastest method rather than the sum over the methods tried in turn.
+//
+// The methods run as the tasks of a WorkStealingPool that outlives the solve, so a race costs a
+// wake-up of threads that already exist instead of starting and joining one thread per method.
+// Pass a pool in, or leave it to the calling thread's own, created by its first portfolio solve.
+//
+// f is called concurrently from all racing threads and must be safe to call that way.
+
+// The methods a portfolio can race.
+enum class PortfolioMethod {
+    Bisection,      // try_bisection_solver() on [leftBound, rightBound]
+    NewtonRaphson,  // try_newton_raphson_solver() from initialGuess
+    Secant,         // try_secant_solver() from leftBound and rightBound
+    FalsePosition,  // try_false_position_solver() on [leftBound, rightBound]
+    Steffensen,     // try_steffensen_solver() on the fixed-point form g(x) = x - f(x), from initialGuess
+    Brent,          // try_brent_solver() on [leftBound, rightBound]
+};
+
+inline const char* portfolio_method_name(PortfolioMethod method) {
+    switch (method) {
+        case PortfolioMethod::Bisection: return "Bisection";
+        case PortfolioMethod::NewtonRaphson: return "NewtonRaphson";
+        case PortfolioMethod::Secant: return "Secant";
+        case PortfolioMethod::FalsePosition: return "FalsePosition";
+        case PortfolioMethod::Steffensen: return "Steffensen";
+        case PortfolioMethod::Brent: return "Brent";
+    }
+    return "Unknown";
+}
+
+// Outcome of a portfolio solve.
+struct PortfolioResult {
+    SolveResult result;         // of the winner; if no method converged, of the one ending closest to a root
+    PortfolioMethod method{};   // the method `result` comes from
+};
+
+namespace detail {
+
+template <typename F>
+SolveResult run_portfolio_method(PortfolioMethod method, double leftBound, double rightBound, double initialGuess,
+                                 F& f, double tolerance, int maxIterations, std::stop_token token) {
+    switch (method) {
+        case PortfolioMethod::Bisection:
+            return try_bisection_solver(leftBound, rightBound, f, tolerance, maxIterations, CancellationObserver{token});
+        case PortfolioMethod::NewtonRaphson:
+            return try_newton_raphson_solver(initialGuess, f, tolerance, maxIterations, AutomaticDerivative{},
+                                             CancellationObserver{token});
+        case PortfolioMethod::Secant:
+            return try_secant_solver(leftBound, rightBound, f, tolerance, maxIterations, CancellationObserver{token});
+        case PortfolioMethod::FalsePosition:
+            return try_false_position_solver(leftBound, rightBound, f, tolerance, maxIterations,
+                                             CancellationObserver{token});
+        case PortfolioMethod::Steffensen: {
+            SolveResult result = try_steffensen_solver(initialGuess, [&f](double x) { return x - f(x); }, tolerance,
+                                                       maxIterations, CancellationObserver{token});
+            result.fRoot = -result.fRoot;  // g(x) - x = -f(x)
+            return result;
+        }
+        case PortfolioMethod::Brent:
+            return try_brent_solver(leftBound, rightBound, f, tolerance, maxIterations, CancellationObserver{token});
+    }
+    return {};
+}
+
+// The pool of the calling thread's portfolio solves, regrown when a race has more methods than threads.
+inline WorkStealingPool& portfolio_pool(std::size_t threadCount) {
+    static thread_local std::unique_ptr<WorkStealingPool> pool;
+    if (pool == nullptr || pool->thread_count() < threadCount) {
+        pool = std::make_unique<WorkStealingPool>(threadCount);
+    }
+    return *pool;
+}
+
+} // namespace detail
+
+/**
+ * @brief Races the given methods on f and returns the first result that converges.
+ *
+ * Bracketing methods use [leftBound, rightBound], Newton-Raphson and Steffensen start from
+ * initialGuess, and the secant method from the two bounds. Every method keeps its own meaning of
+ * `tolerance` (|f(p)| for bisection, the step or bracket width for the others). The first method to
+ * converge cancels the rest, and the call returns once every thread has stopped, which the others do
+ * within one iteration. A pool with fewer threads than methods starts a method once a thread is
+ * free, so the race is only as wide as the pool.
+ *
+ * @param pool The threads racing the methods; must not be running a parallel_for() of the caller.
+ * @param leftBound The left boundary of the interval.
+ * @param rightBound The right boundary of the interval.
+ * @param initialGuess The starting point of the open methods.
+ * @param f The callable whose root is being sought; called concurrently, so it must be thread-safe.
+ * @param methods The methods to race, each as one task of the pool.
+ * @param tolerance The convergence criterion, passed to every method.
+ * @param maxIterations The maximum number of iterations of every method.
+ * @return PortfolioResult with the winning method and its result. If none converged, the result
+ *         with the smallest |fRoot| and its method.
+ * @throws std::invalid_argument If `methods` is empty.
+ * @throws Whatever f throws, if every method failed and at least one did so by an exception.
+ */
+template <typename F>
+PortfolioResult portfolio_solver(WorkStealingPool& pool, double leftBound, double rightBound,
+                                 double initialGuess, F&& f,
+                                 std::initializer_list<PortfolioMethod> methods = {PortfolioMethod::NewtonRaphson,
+                                     PortfolioMethod::Secant, PortfolioMethod::Steffensen, PortfolioMethod::Brent},
+                                 double tolerance = 1e-6, int maxIterations = 1000000) {
+    if (methods.size() == 0) {
+        throw std::invalid_argument("A portfolio needs at least one method.");
+    }
+
+    std::stop_source stop;
+    std::mutex mutex;
+    std::vector<SolveResult> results(methods.size());
+    std::exception_ptr error;
+    std::size_t winner = methods.size();
+    pool.parallel_for(methods.size(), 1, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t index = begin; index < end; index++) {
+            try {
+                SolveResult result = detail::run_portfolio_method(methods.begin()[index], leftBound, rightBound,
+                                                                  initialGuess, f, tolerance, maxIterations,
+                                                                  stop.get_token());
+                std::lock_guard<std::mutex> lock(mutex);
+                results[index] = result;
+                if (result.converged() && winner == methods.size()) {
+                    winner = index;
+                    stop.request_stop();
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                results[index].status = SolveStatus::Cancelled;
+                results[index].fRoot = std::numeric_limits<double>::infinity();
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    });
+
+    if (winner == methods.size()) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        winner = 0;
+        for (std::size_t i = 1; i < results.size(); i++) {
+            if (std::abs(results[i].fRoot) < std::abs(results[winner].fRoot)) {
+                winner = i;
+            }
+        }
+    }
+    return {results[winner], methods.begin()[winner]};
+}
+
+/**
+ * @brief Races the given methods on f and returns the first result that converges.
+ *
+ * portfolio_solver() on the calling thread's portfolio pool, which keeps as many threads as the
+ * largest race it has run.
+ */
+template <typename F>
+PortfolioResult portfolio_solver(double leftBound, double rightBound, double initialGuess, F&& f,
+                                 std::initializer_list<PortfolioMethod> methods = {PortfolioMethod::NewtonRaphson,
+                                     PortfolioMethod::Secant, PortfolioMethod::Steffensen, PortfolioMethod::Brent},
+                                 double tolerance = 1e-6, int maxIterations = 1000000) {
+    return portfolio_solver(detail::portfolio_pool(methods.size()), leftBound, rightBound, initialGuess,
+                            std::forward<F>(f), methods, tolerance, maxIterations);
+}
+
+#endif //PORTFOLIO_SOLVER_H
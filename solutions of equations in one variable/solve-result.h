@@ -0,0 +1,58 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef SOLVE_RESULT_H
+#define SOLVE_RESULT_H
+
+// Why a solver stopped.
+enum class SolveStatus {
+    Converged,              // the stopping criterion was met
+    MaxIterationsReached,   // the iteration limit was hit before converging
+    InvalidBracket,         // the function values at the initial points do not have opposite signs
+    ZeroDerivative,         // Newton-type step with a vanishing derivative
+    DenominatorTooSmall,    // Aitken's Δ² (or a similar update) would divide by a value near zero
+    Cancelled,              // the observer requested a stop (see CancellationObserver)
+    BudgetExceeded,         // the evaluation budget or the deadline of a StoppingCriteria ran out
+    OutsideBracket,         // converged, but to a root outside the bracket it was asked for
+};
+
+inline const char* solve_status_name(SolveStatus status) {
+    switch (status) {
+        case SolveStatus::Converged: return "Converged";
+        case SolveStatus::MaxIterationsReached: return "MaxIterationsReached";
+        case SolveStatus::InvalidBracket: return "InvalidBracket";
+        case SolveStatus::ZeroDerivative: return "ZeroDerivative";
+        case SolveStatus::DenominatorTooSmall: return "DenominatorTooSmall";
+        case SolveStatus::Cancelled: return "Cancelled";
+        case SolveStatus::BudgetExceeded: return "BudgetExceeded";
+        case SolveStatus::OutsideBracket: return "OutsideBracket";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Outcome of a non-throwing solve (the `try_*` solvers).
+ *
+ * `root` is the last iterate, also when the solver did not converge, and `fRoot` is the function
+ * value at the last point the solver evaluated. For the fixed-point methods it is the fixed-point
+ * residual g(x) - x instead. `evaluations` counts every call of the objective, including the ones
+ * spent on numerical derivatives.
+ *
+ * The solvers that are generic over the scalar type return a BasicSolveResult of that type.
+ */
+template <typename T>
+struct BasicSolveResult {
+    T root = 0;
+    T fRoot = 0;
+    int iterations = 0;
+    int evaluations = 0;
+    SolveStatus status = SolveStatus::MaxIterationsReached;
+
+    constexpr bool converged() const { return status == SolveStatus::Converged; }
+    constexpr explicit operator bool() const { return converged(); }
+};
+
+using SolveResult = BasicSolveResult<double>;
+
+#endif //SOLVE_RESULT_H
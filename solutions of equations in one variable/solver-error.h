@@ -0,0 +1,59 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef SOLVER_ERROR_H
+#define SOLVER_ERROR_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#include "solve-result.h"
+
+namespace detail {
+
+// Shared by every SolverError, so constructing one copies a reference-counted message instead of
+// allocating a new one
+inline const std::runtime_error& solver_error_base() {
+    static const std::runtime_error base("Solver failure.");
+    return base;
+}
+
+} // namespace detail
+
+/**
+ * @brief Thrown by the throwing form of a method when it stops without a root.
+ *
+ * what() is `before`, then `count`, then `after` ("No solution found after 1000 iterations."),
+ * formatted with std::to_chars into the exception itself: raising it does not allocate beyond the
+ * exception object, where the std::to_string messages it replaces took three heap allocations.
+ * Catch it as std::runtime_error like before, or as SolverError for the status.
+ */
+class SolverError : public std::runtime_error {
+public:
+    SolverError(SolveStatus status, const char* before, int count, const char* after) noexcept
+        : std::runtime_error(detail::solver_error_base()), solveStatus(status) {
+        char* end = message + sizeof message - 1;
+        char* out = append(message, end, before);
+        out = std::to_chars(out, end, count).ptr;
+        out = append(out, end, after);
+        *out = '\0';
+    }
+
+    const char* what() const noexcept override { return message; }
+    SolveStatus status() const noexcept { return solveStatus; }
+
+private:
+    static char* append(char* out, char* end, const char* text) noexcept {
+        std::size_t length = std::min<std::size_t>(std::strlen(text), static_cast<std::size_t>(end - out));
+        std::memcpy(out, text, length);
+        return out + length;
+    }
+
+    SolveStatus solveStatus;
+    char message[96];
+};
+
+#endif //SOLVER_ERROR_H
@@ -0,0 +1,187 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "solver-metrics.h"
+
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+
+namespace {
+
+struct MeteredSolver {
+    std::string name;
+    std::vector<std::unique_ptr<MetricsShard>> shards;
+    std::vector<MetricsShard*> freeShards;  // shards of exited threads, reused by new ones
+};
+
+// Never destroyed, so threads recording during static destruction find it alive.
+struct MetricsRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<MeteredSolver>> solvers;
+    TickCalibration clock;
+};
+
+MetricsRegistry& metrics_registry() {
+    static MetricsRegistry* registry = new MetricsRegistry;
+    return *registry;
+}
+
+// The shards of the calling thread, by solver id. On thread exit they go back to the registry with
+// their counts, so the totals stay complete and the number of shards is bounded by the number of
+// threads alive at once.
+struct ThreadShards {
+    std::array<MetricsShard*, maxMeteredSolvers> shards{};
+
+    ~ThreadShards() {
+        MetricsRegistry& registry = metrics_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (std::size_t id = 0; id < shards.size(); id++) {
+            if (shards[id] != nullptr) {
+                registry.solvers[id]->freeShards.push_back(shards[id]);
+            }
+        }
+    }
+};
+
+thread_local ThreadShards threadShards;
+
+MetricsShard& thread_shard(std::size_t id) {
+    MetricsShard*& shard = threadShards.shards[id];
+    if (shard == nullptr) {
+        MetricsRegistry& registry = metrics_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        MeteredSolver& solver = *registry.solvers[id];
+        if (!solver.freeShards.empty()) {
+            shard = solver.freeShards.back();
+            solver.freeShards.pop_back();
+        } else {
+            solver.shards.push_back(std::make_unique<MetricsShard>());
+            shard = solver.shards.back().get();
+        }
+    }
+    return *shard;
+}
+
+// Single-writer increment: a relaxed load and store, without the locked read-modify-write of fetch_add.
+void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+std::size_t histogram_bucket(int iterations) {
+    if (iterations <= 0) {
+        return 0;
+    }
+    std::size_t bucket = static_cast<std::size_t>(std::bit_width(static_cast<unsigned>(iterations)));
+    return std::min(bucket, iterationHistogramBuckets - 1);
+}
+
+// Sums the shards of one solver; the registry lock must be held
+SolverMetricsSnapshot snapshot_of(const MeteredSolver& solver, double nanosecondsPerTick) {
+    auto read = [](const std::atomic<std::uint64_t>& counter) { return counter.load(std::memory_order_relaxed); };
+    SolverMetricsSnapshot snapshot;
+    snapshot.solver = solver.name;
+    std::uint64_t functionTicks = 0;
+    std::uint64_t totalTicks = 0;
+    for (const std::unique_ptr<MetricsShard>& shard : solver.shards) {
+        snapshot.solves += read(shard->solves);
+        snapshot.iterations += read(shard->iterations);
+        snapshot.evaluations += read(shard->evaluations);
+        functionTicks += read(shard->functionTicks);
+        totalTicks += read(shard->totalTicks);
+        for (std::size_t s = 0; s < solveStatusCount; s++) {
+            snapshot.statuses[s] += read(shard->statuses[s]);
+        }
+        for (std::size_t b = 0; b < iterationHistogramBuckets; b++) {
+            snapshot.iterationHistogram[b] += read(shard->iterationHistogram[b]);
+        }
+    }
+    snapshot.functionSeconds = static_cast<double>(functionTicks) * nanosecondsPerTick * 1e-9;
+    snapshot.totalSeconds = static_cast<double>(totalTicks) * nanosecondsPerTick * 1e-9;
+    return snapshot;
+}
+
+std::string quoted(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+
+} // namespace
+
+void SolverMetrics::record(const SolveResult& result, std::uint64_t functionTicks, std::uint64_t totalTicks) {
+    MetricsShard& shard = thread_shard(id);
+    add(shard.solves, 1);
+    add(shard.iterations, static_cast<std::uint64_t>(std::max(result.iterations, 0)));
+    add(shard.evaluations, static_cast<std::uint64_t>(std::max(result.evaluations, 0)));
+    add(shard.functionTicks, functionTicks);
+    add(shard.totalTicks, totalTicks);
+    add(shard.statuses[static_cast<std::size_t>(result.status)], 1);
+    add(shard.iterationHistogram[histogram_bucket(result.iterations)], 1);
+}
+
+SolverMetrics& solver_metrics(std::string_view name) {
+    // Handles live as long as the registry; one per solver
+    static std::vector<std::unique_ptr<SolverMetrics>>* handles = new std::vector<std::unique_ptr<SolverMetrics>>;
+
+    MetricsRegistry& registry = metrics_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (std::size_t id = 0; id < registry.solvers.size(); id++) {
+        if (registry.solvers[id]->name == name) {
+            return *(*handles)[id];
+        }
+    }
+    if (registry.solvers.size() == maxMeteredSolvers) {
+        throw std::length_error("At most " + std::to_string(maxMeteredSolvers) + " solvers can be metered.");
+    }
+    registry.solvers.push_back(std::make_unique<MeteredSolver>());
+    registry.solvers.back()->name = name;
+    handles->push_back(std::make_unique<SolverMetrics>(registry.solvers.size() - 1));
+    return *handles->back();
+}
+
+SolverMetricsSnapshot SolverMetrics::snapshot() const {
+    MetricsRegistry& registry = metrics_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return snapshot_of(*registry.solvers[id], registry.clock.nanoseconds_per_tick());
+}
+
+std::vector<SolverMetricsSnapshot> metrics_snapshot() {
+    MetricsRegistry& registry = metrics_registry();
+    std::vector<SolverMetricsSnapshot> snapshots;
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const double nanosecondsPerTick = registry.clock.nanoseconds_per_tick();
+    for (const std::unique_ptr<MeteredSolver>& solver : registry.solvers) {
+        snapshots.push_back(snapshot_of(*solver, nanosecondsPerTick));
+    }
+    return snapshots;
+}
+
+void write_metrics_json(std::ostream& out) {
+    std::vector<SolverMetricsSnapshot> snapshots = metrics_snapshot();
+    out << "{\"solvers\": [";
+    for (std::size_t i = 0; i < snapshots.size(); i++) {
+        const SolverMetricsSnapshot& s = snapshots[i];
+        out << (i == 0 ? "\n" : ",\n") << "  {\"solver\": " << quoted(s.solver) << ", \"solves\": " << s.solves
+            << ", \"iterations\": " << s.iterations << ", \"evaluations\": " << s.evaluations << ", \"statuses\": {";
+        for (std::size_t k = 0; k < solveStatusCount; k++) {
+            out << (k == 0 ? "" : ", ") << quoted(solve_status_name(static_cast<SolveStatus>(k))) << ": " << s.statuses[k];
+        }
+        out << "}, \"iteration_histogram\": [";
+        for (std::size_t b = 0; b < iterationHistogramBuckets; b++) {
+            out << (b == 0 ? "" : ", ") << s.iterationHistogram[b];
+        }
+        out << "], \"function_seconds\": " << s.functionSeconds << ", \"total_seconds\": " << s.totalSeconds
+            << ", \"overhead_seconds\": " << s.overhead_seconds() << "}";
+    }
+    out << "\n]}\n";
+}
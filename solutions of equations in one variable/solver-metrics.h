@@ -0,0 +1,184 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef SOLVER_METRICS_H
+#define SOLVER_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cycle-clock.h"
+#include "solve-result.h"
+
+// Solver metrics: aggregate counters of every metered solve, for choosing methods from production
+// numbers rather than by hand.
+//
+// For each solver the registry counts solves, the SolveStatus they ended with, iterations (total and
+// as a histogram), evaluations, and the time spent inside the objective against the time of the
+// whole solve; the difference is the overhead of the solver itself. Counters are sharded per thread
+// (each thread only ever writes its own shard, with plain relaxed stores), so parallel batches do
+// not contend; metrics_snapshot() sums the shards and may be called at any time from any thread.
+//
+// Metering is opt-in: nothing is counted until set_metrics_enabled(true), and until then a metered
+// solve costs one relaxed load. The function-pointer solvers of equations-solver.cpp and
+// accelerated-solvers.cpp are metered under their method names; templated calls are metered by
+// wrapping them in metered_solve():
+//
+//     static SolverMetrics& brentMetrics = solver_metrics("brent");
+//     SolveResult r = metered_solve(brentMetrics, f, [&](auto& metered) { return try_brent_solver(a, b, metered); });
+//
+// The objective is timed per evaluation with cycle_clock_ticks(), whose own cost (a few ns) is
+// counted as time inside the objective.
+
+// solve_status_name() of every status, in enum order.
+inline constexpr std::size_t solveStatusCount = static_cast<std::size_t>(SolveStatus::OutsideBracket) + 1;
+
+// Bucket 0 counts solves with 0 iterations, bucket k those with [2^(k-1), 2^k) iterations; the last one is open.
+inline constexpr std::size_t iterationHistogramBuckets = 16;
+
+// Solvers that can be registered; every ProblemClass of auto-solver.h takes one per method.
+inline constexpr std::size_t maxMeteredSolvers = 256;
+
+// Counters of one solver, summed over all threads.
+struct SolverMetricsSnapshot {
+    std::string solver;
+    std::uint64_t solves = 0;
+    std::uint64_t iterations = 0;
+    std::uint64_t evaluations = 0;
+    std::array<std::uint64_t, solveStatusCount> statuses{};                  // indexed by SolveStatus
+    std::array<std::uint64_t, iterationHistogramBuckets> iterationHistogram{};
+    double functionSeconds = 0;     // inside the objective
+    double totalSeconds = 0;        // whole solves, objective included
+
+    double overhead_seconds() const { return totalSeconds - functionSeconds; }
+    std::uint64_t failures() const { return solves - statuses[static_cast<std::size_t>(SolveStatus::Converged)]; }
+};
+
+// Counters of one solver on one thread. Written only by that thread; read by snapshots.
+struct MetricsShard {
+    std::atomic<std::uint64_t> solves = 0;
+    std::atomic<std::uint64_t> iterations = 0;
+    std::atomic<std::uint64_t> evaluations = 0;
+    std::atomic<std::uint64_t> functionTicks = 0;
+    std::atomic<std::uint64_t> totalTicks = 0;
+    std::array<std::atomic<std::uint64_t>, solveStatusCount> statuses{};
+    std::array<std::atomic<std::uint64_t>, iterationHistogramBuckets> iterationHistogram{};
+};
+
+/**
+ * @brief Handle of one solver in the metrics registry, obtained from solver_metrics().
+ */
+class SolverMetrics {
+public:
+    explicit SolverMetrics(std::size_t id) : id(id) {}
+
+    /**
+     * @brief Counts one solve of this solver on the calling thread.
+     *
+     * @param functionTicks cycle_clock_ticks() spent inside the objective.
+     * @param totalTicks cycle_clock_ticks() of the whole solve.
+     */
+    void record(const SolveResult& result, std::uint64_t functionTicks, std::uint64_t totalTicks);
+
+    // Counters of this solver summed over all threads, as in metrics_snapshot().
+    SolverMetricsSnapshot snapshot() const;
+
+private:
+    std::size_t id;
+};
+
+namespace detail {
+inline std::atomic<bool> metricsEnabled = false;
+} // namespace detail
+
+// Turns metering on or off for all solvers.
+inline void set_metrics_enabled(bool enabled) {
+    detail::metricsEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+inline bool metrics_enabled() {
+    return detail::metricsEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief The metrics handle of the solver called `name`, registered on first use.
+ *
+ * Registration takes a lock; keep the reference (e.g. in a function-local static).
+ *
+ * @throws std::length_error If more than maxMeteredSolvers solvers are registered.
+ */
+SolverMetrics& solver_metrics(std::string_view name);
+
+// Counters of every registered solver, in registration order.
+std::vector<SolverMetricsSnapshot> metrics_snapshot();
+
+/**
+ * @brief Writes metrics_snapshot() as JSON:
+ *
+ *     {"solvers": [{"solver": "brent", "solves": 12, "statuses": {"Converged": 11, ...},
+ *                   "iteration_histogram": [...], "function_seconds": ..., ...}, ...]}
+ */
+void write_metrics_json(std::ostream& out);
+
+/**
+ * @brief Objective wrapper counting the time spent inside `f`.
+ *
+ * Forwards every call, including dual-number and Taylor-jet calls and value_and_derivative(), so the
+ * solver sees the same capabilities as in `f` itself.
+ */
+template <typename F>
+class MeteredFunction {
+public:
+    explicit MeteredFunction(F& f) : f(f) {}
+
+    template <typename T>
+        requires std::is_invocable_v<F&, T>
+    auto operator()(T&& x) -> std::invoke_result_t<F&, T> {
+        std::uint64_t start = cycle_clock_ticks();
+        auto&& y = f(std::forward<T>(x));
+        ticks += cycle_clock_ticks() - start;
+        return std::forward<decltype(y)>(y);
+    }
+
+    auto value_and_derivative(double x) requires requires(F& g, double v) { g.value_and_derivative(v); } {
+        std::uint64_t start = cycle_clock_ticks();
+        auto y = f.value_and_derivative(x);
+        ticks += cycle_clock_ticks() - start;
+        return y;
+    }
+
+    std::uint64_t function_ticks() const { return ticks; }
+
+private:
+    F& f;
+    std::uint64_t ticks = 0;
+};
+
+/**
+ * @brief Runs `solve(f)` and counts the solve under `metrics` when metering is enabled.
+ *
+ * `solve` is called with a MeteredFunction wrapping `f` when metering is enabled and with `f`
+ * itself otherwise, so it must be generic over the objective, and returns the SolveResult.
+ */
+template <typename F, typename Solve>
+SolveResult metered_solve(SolverMetrics& metrics, F&& f, Solve&& solve) {
+    if (!metrics_enabled()) {
+        return solve(f);
+    }
+    std::uint64_t start = cycle_clock_ticks();
+    MeteredFunction<std::remove_reference_t<F>> metered(f);
+    SolveResult result = solve(metered);
+    metrics.record(result, metered.function_ticks(), cycle_clock_ticks() - start);
+    return result;
+}
+
+#endif //SOLVER_METRICS_H
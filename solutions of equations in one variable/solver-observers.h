@@ -0,0 +1,218 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef SOLVER_OBSERVERS_H
+#define SOLVER_OBSERVERS_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+
+// Observers receive the per-iteration values of a solver. Every templated solver takes one as
+// its last argument; an observer provides three members:
+//   on_start(columns)        - called once with the names and widths of the table columns
+//   on_iteration(i, values)  - called once per iteration with the values of one table row
+//   on_converged(p)          - called when the solver accepts p as the solution
+// and may provide two more:
+//   on_start(solver, columns) - called instead of on_start(columns), with the name of the solver too
+//                               (e.g. "brent"), by observers that tell solvers with the same table apart
+//   stop_requested()         - checked at the start of every iteration; when it returns true the
+//                              solver stops with status `Cancelled`
+// Solvers announce themselves through detail::start_table(), which picks the overload.
+
+// Name and printed width of one column of an iteration table.
+struct IterationColumn {
+    const char* name;
+    int width;
+};
+
+#ifdef NUMERICAL_ANALYSIS_TRACING
+namespace detail {
+
+// Hooks of the implicit iteration tracing, defined in iteration-trace.cpp. trace_start() returns 0,
+// and the others do nothing for that layout, unless set_tracing_enabled(true).
+std::uint32_t trace_start(const char* solver, std::initializer_list<IterationColumn> columns);
+void trace_iteration(std::uint32_t layout, int i, std::initializer_list<double> values);
+void trace_converged(std::uint32_t layout, double p);
+
+} // namespace detail
+#endif
+
+// Default observer: does nothing, so the calls compile away and the solver loop only does arithmetic.
+// Builds with NUMERICAL_ANALYSIS_TRACING record the iterations while tracing is enabled (see iteration-trace.h),
+// except in solves evaluated at compile time. Being constexpr, it keeps the solvers usable in constant expressions.
+struct NullObserver {
+#ifdef NUMERICAL_ANALYSIS_TRACING
+    std::uint32_t traceLayout = 0;
+
+    constexpr void on_start(std::initializer_list<IterationColumn> columns) { on_start("", columns); }
+    constexpr void on_start(const char* solver, std::initializer_list<IterationColumn> columns) {
+        if (!std::is_constant_evaluated()) {
+            traceLayout = detail::trace_start(solver, columns);
+        }
+    }
+    constexpr void on_iteration(int i, std::initializer_list<double> values) {
+        if (!std::is_constant_evaluated()) {
+            detail::trace_iteration(traceLayout, i, values);
+        }
+    }
+    constexpr void on_converged(double p) {
+        if (!std::is_constant_evaluated()) {
+            detail::trace_converged(traceLayout, p);
+        }
+    }
+#else
+    constexpr void on_start(std::initializer_list<IterationColumn>) {}
+    constexpr void on_start(const char*, std::initializer_list<IterationColumn>) {}
+    constexpr void on_iteration(int, std::initializer_list<double>) {}
+    constexpr void on_converged(double) {}
+#endif
+};
+
+/**
+ * @brief Observer printing the classic iteration table of a solver.
+ *
+ * The output is the same table the solvers used to print themselves: a header row, one
+ * `std::setw`-formatted row per iteration in fixed notation with 6 decimals and a final
+ * "Algorithm stops with solution" line. The formatting state of the stream is restored when the
+ * printer is destroyed, so a temporary `TablePrinter{}` leaves `std::cout` untouched.
+ */
+class TablePrinter {
+public:
+    explicit TablePrinter(std::ostream& out = std::cout)
+        : out(out), savedFlags(out.flags()), savedPrecision(out.precision()) {}
+
+    TablePrinter(const TablePrinter&) = delete;
+    TablePrinter& operator=(const TablePrinter&) = delete;
+
+    ~TablePrinter() {
+        out.flags(savedFlags);
+        out.precision(savedPrecision);
+    }
+
+    void on_start(std::initializer_list<IterationColumn> columns) { on_start("", columns); }
+
+    void on_start([[maybe_unused]] const char* solver, std::initializer_list<IterationColumn> columns) {
+#ifdef NUMERICAL_ANALYSIS_TRACING
+        traceLayout = detail::trace_start(solver, columns);
+#endif
+        print_header(std::span<const IterationColumn>(columns.begin(), columns.size()));
+    }
+
+    void on_iteration(int i, std::initializer_list<double> values) {
+#ifdef NUMERICAL_ANALYSIS_TRACING
+        detail::trace_iteration(traceLayout, i, values);
+#endif
+        print_row(i, std::span<const double>(values.begin(), values.size()));
+    }
+
+    void on_converged(double p) {
+#ifdef NUMERICAL_ANALYSIS_TRACING
+        detail::trace_converged(traceLayout, p);
+#endif
+        out << "Algorithm stops with solution: " << p << std::endl;
+    }
+
+    // The header and row printers behind on_start() and on_iteration(), for tables not produced by a solver.
+    void print_header(std::span<const IterationColumn> columns) {
+        out << std::fixed << std::setprecision(6);
+        columnCount = 0;
+        for (const IterationColumn& column : columns) {
+            if (columnCount < maxColumns) {
+                widths[columnCount++] = column.width;
+            }
+            out << std::setw(column.width) << column.name;
+        }
+        out << std::endl;
+    }
+
+    void print_row(int i, std::span<const double> values) {
+        std::size_t column = 0;
+        out << std::setw(width(column++)) << i;
+        for (double value : values) {
+            out << std::setw(width(column++)) << value;
+        }
+        out << std::endl;
+    }
+
+private:
+    static constexpr std::size_t maxColumns = 8;
+
+    int width(std::size_t column) const {
+        return column < columnCount ? widths[column] : 15;
+    }
+
+    std::ostream& out;
+    std::ios_base::fmtflags savedFlags;
+    std::streamsize savedPrecision;
+    int widths[maxColumns] = {};
+    std::size_t columnCount = 0;
+#ifdef NUMERICAL_ANALYSIS_TRACING
+    std::uint32_t traceLayout = 0;
+#endif
+};
+
+/**
+ * @brief Observer forwarding every iteration row to a user callback.
+ *
+ * The callback is invoked as `callback(i, values)` with the iteration number and the row values
+ * (`std::initializer_list<double>`), in the column order the solver documents.
+ */
+template <typename Callback>
+struct CallbackObserver {
+    Callback callback;
+
+    void on_start(std::initializer_list<IterationColumn>) {}
+    void on_iteration(int i, std::initializer_list<double> values) { callback(i, values); }
+    void on_converged(double) {}
+};
+
+template <typename Callback>
+CallbackObserver<std::decay_t<Callback>> make_callback_observer(Callback&& callback) {
+    return {std::forward<Callback>(callback)};
+}
+
+// Observer that lets another thread cancel the solve through a std::stop_token.
+struct CancellationObserver {
+    std::stop_token token;
+
+    void on_start(std::initializer_list<IterationColumn>) {}
+    void on_iteration(int, std::initializer_list<double>) {}
+    void on_converged(double) {}
+    bool stop_requested() const { return token.stop_requested(); }
+};
+
+namespace detail {
+
+// Starts the table of the solver named `solver`: on_start(solver, columns) if the observer has it,
+// on_start(columns) otherwise.
+template <typename Observer>
+constexpr void start_table(Observer& observer, const char* solver, std::initializer_list<IterationColumn> columns) {
+    if constexpr (requires { observer.on_start(solver, columns); }) {
+        observer.on_start(solver, columns);
+    } else {
+        observer.on_start(columns);
+    }
+}
+
+// Whether the observer asks the solver to stop; always false, at no cost, for observers without stop_requested().
+template <typename Observer>
+constexpr bool stop_requested(const Observer& observer) {
+    if constexpr (requires { { observer.stop_requested() } -> std::convertible_to<bool>; }) {
+        return observer.stop_requested();
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+#endif //SOLVER_OBSERVERS_H
@@ -0,0 +1,114 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "solver-workspace.h"
+
+#include <algorithm>
+#include <new>
+
+struct SolverWorkspace::Overflow {
+    Overflow* next;
+    std::size_t size;   // bytes after the header
+    std::size_t used;
+};
+
+namespace {
+
+constexpr std::size_t round_up(std::size_t bytes) {
+    return (bytes + SolverWorkspace::alignment - 1) / SolverWorkspace::alignment * SolverWorkspace::alignment;
+}
+
+// The header of an overflow block, padded so the memory after it stays aligned
+constexpr std::size_t overflowHeader = round_up(sizeof(void*) + 2 * sizeof(std::size_t));
+
+std::byte* allocate_block(std::size_t bytes) {
+    return static_cast<std::byte*>(::operator new(bytes, std::align_val_t(SolverWorkspace::alignment)));
+}
+
+void free_block(void* block) {
+    ::operator delete(block, std::align_val_t(SolverWorkspace::alignment));
+}
+
+} // namespace
+
+SolverWorkspace::SolverWorkspace(std::size_t capacity) : blockSize(round_up(capacity)) {
+    if (blockSize > 0) {
+        block = allocate_block(blockSize);
+        heapAllocations = 1;
+    }
+}
+
+SolverWorkspace::~SolverWorkspace() {
+    while (overflow != nullptr) {
+        Overflow* next = overflow->next;
+        free_block(overflow);
+        overflow = next;
+    }
+    if (block != nullptr) {
+        free_block(block);
+    }
+}
+
+SolverWorkspace::Scope::Scope(SolverWorkspace& workspace) : workspace(workspace), mark(workspace.offset) {
+    workspace.depth++;
+}
+
+SolverWorkspace::Scope::~Scope() {
+    workspace.depth--;
+    workspace.rewind(mark);
+}
+
+void* SolverWorkspace::do_allocate(std::size_t bytes, std::size_t align) {
+    static_assert(sizeof(Overflow) <= overflowHeader);
+    if (align > alignment) {
+        throw std::bad_alloc();
+    }
+    const std::size_t size = round_up(std::max<std::size_t>(bytes, 1));
+    void* memory;
+    if (offset + size <= blockSize) {
+        memory = block + offset;
+        offset += size;
+    } else {
+        if (overflow == nullptr || overflow->used + size > overflow->size) {
+            // At least as large as the arena, so a workspace that keeps overflowing doubles
+            const std::size_t capacity = std::max(size, blockSize);
+            auto* next = reinterpret_cast<Overflow*>(allocate_block(overflowHeader + capacity));
+            *next = {overflow, capacity, 0};
+            overflow = next;
+            heapAllocations++;
+        }
+        memory = reinterpret_cast<std::byte*>(overflow) + overflowHeader + overflow->used;
+        overflow->used += size;
+        overflowUsed += size;
+    }
+    peakUsed = std::max(peakUsed, offset + overflowUsed);
+    return memory;
+}
+
+void SolverWorkspace::rewind(std::size_t mark) {
+    offset = mark;
+    if (depth == 0 && offset == 0) {
+        fold_overflow();
+    }
+}
+
+void SolverWorkspace::fold_overflow() {
+    if (overflow == nullptr) {
+        return;
+    }
+    while (overflow != nullptr) {
+        Overflow* next = overflow->next;
+        free_block(overflow);
+        overflow = next;
+    }
+    overflowUsed = 0;
+
+    // Everything the scopes held at once now fits the arena
+    if (block != nullptr) {
+        free_block(block);
+    }
+    blockSize = round_up(peakUsed);
+    block = allocate_block(blockSize);
+    heapAllocations++;
+}
@@ -0,0 +1,106 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef SOLVER_WORKSPACE_H
+#define SOLVER_WORKSPACE_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+
+/**
+ * @brief Reusable scratch memory of the solvers: a monotonic arena of cache-line aligned blocks.
+ *
+ * The engines that need buffers — the parallel batch driver, the all-roots finder, the k-section
+ * solver and Newton's method for systems — have overloads taking a SolverWorkspace. They open a
+ * Scope, take their arrays from the arena with allocate_array() and hand everything back when the
+ * scope closes, so the next solve reuses the same memory.
+ *
+ * What does not fit goes to overflow blocks taken from the heap. When the outermost scope closes
+ * they are freed and the arena is regrown once to the peak it reached, so after the first solve of
+ * the largest size a workspace serves every further solve without a heap allocation. This is why it
+ * does not use std::pmr::monotonic_buffer_resource, whose release() returns its grown blocks and
+ * takes them from the heap again on the next solve. It is also a std::pmr::memory_resource, for
+ * pmr containers living as long as a scope.
+ *
+ * A workspace is not thread-safe: allocate one per thread. The engines running on a pool take their
+ * buffers from the calling thread's workspace before the workers start.
+ */
+class SolverWorkspace : public std::pmr::memory_resource {
+public:
+    // Alignment of every allocation, one cache line so no two buffers share one.
+    static constexpr std::size_t alignment = 64;
+
+    explicit SolverWorkspace(std::size_t capacity = 64 * 1024);
+    ~SolverWorkspace() override;
+
+    SolverWorkspace(const SolverWorkspace&) = delete;
+    SolverWorkspace& operator=(const SolverWorkspace&) = delete;
+
+    /**
+     * @brief Marks the arena on construction and gives back everything allocated since on destruction.
+     *
+     * Scopes nest; closing the outermost one also folds the overflow blocks into the arena.
+     */
+    class Scope {
+    public:
+        explicit Scope(SolverWorkspace& workspace);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        SolverWorkspace& workspace;
+        std::size_t mark;
+    };
+
+    /**
+     * @brief `count` value-initialized elements of T, aligned to a cache line, valid until the
+     *        enclosing Scope closes.
+     */
+    template <typename T>
+    std::span<T> allocate_array(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "The arena never runs destructors.");
+        static_assert(alignof(T) <= alignment);
+        if (count == 0) {
+            return {};
+        }
+        T* first = static_cast<T*>(allocate(count * sizeof(T), alignment));
+        std::uninitialized_value_construct_n(first, count);
+        return {first, count};
+    }
+
+    std::size_t capacity() const { return blockSize; }
+    // Bytes handed out in the open scopes, overflow included.
+    std::size_t used() const { return offset + overflowUsed; }
+    // The most bytes handed out at once since construction.
+    std::size_t peak() const { return peakUsed; }
+    // Blocks taken from the heap since construction: the arena and its overflow blocks.
+    std::size_t heap_allocations() const { return heapAllocations; }
+
+private:
+    struct Overflow;
+
+    void* do_allocate(std::size_t bytes, std::size_t align) override;
+    // Monotonic: memory comes back when its scope closes.
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    void rewind(std::size_t mark);
+    void fold_overflow();
+
+    std::byte* block = nullptr;
+    std::size_t blockSize = 0;
+    std::size_t offset = 0;
+    Overflow* overflow = nullptr;       // newest overflow block first
+    std::size_t overflowUsed = 0;
+    std::size_t peakUsed = 0;
+    std::size_t heapAllocations = 0;
+    int depth = 0;                      // open scopes
+};
+
+#endif //SOLVER_WORKSPACE_H
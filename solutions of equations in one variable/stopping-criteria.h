@@ -0,0 +1,147 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef STOPPING_CRITERIA_H
+#define STOPPING_CRITERIA_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+
+#include "dual.h"
+#include "solve-result.h"
+#include "solver-observers.h"
+#include "taylor-jet.h"
+
+/**
+ * @brief Limits of one solve, an alternative to the (tolerance, maxIterations) pair of every solver.
+ *
+ * Every try_ solver has an overload taking a StoppingCriteria instead of those two arguments. It
+ * stops successfully when
+ *   - the method's own criterion is met with the x tolerance max(absoluteTolerance,
+ *     relativeTolerance·scale), where scale is the largest magnitude of the starting points (at least 1), or
+ *   - f is evaluated at a point with |f| <= residualTolerance (|g(x) - x| for fixed-point methods),
+ * and stops with status `BudgetExceeded` once maxEvaluations evaluations have been spent or the
+ * deadline has passed. Budgets are checked at the start of every iteration, so a solve overruns
+ * them by at most the evaluations of one iteration; it then returns the best iterate found, the
+ * evaluated point with the smallest residual.
+ *
+ *     StoppingCriteria criteria;
+ *     criteria.maxEvaluations = 50;
+ *     criteria.deadline = StoppingCriteria::after(std::chrono::microseconds(200));
+ *     SolveResult result = try_newton_raphson_solver(1.5, f, criteria);
+ */
+struct StoppingCriteria {
+    using Clock = std::chrono::steady_clock;
+
+    double absoluteTolerance = 1e-6;
+    double relativeTolerance = 0;
+    double residualTolerance = 0;       // 0 disables the residual criterion
+    int maxIterations = 1000000;
+    long maxEvaluations = std::numeric_limits<long>::max();
+    Clock::time_point deadline = Clock::time_point::max();
+
+    // A deadline `duration` from now.
+    template <typename Rep, typename Period>
+    static Clock::time_point after(std::chrono::duration<Rep, Period> duration) {
+        return Clock::now() + std::chrono::duration_cast<Clock::duration>(duration);
+    }
+
+    // The x tolerance for starting points of magnitude up to `scale`.
+    double tolerance(double scale) const {
+        return std::max(absoluteTolerance, relativeTolerance * std::max(std::abs(scale), 1.0));
+    }
+};
+
+namespace detail {
+
+// The plain value of an argument or result the solvers evaluate f on.
+inline double primal(double x) { return x; }
+template <typename T>
+double primal(const Dual<T>& x) { return primal(x.value); }
+template <typename T, std::size_t N>
+double primal(const Jet<T, N>& x) { return primal(x.c[0]); }
+template <typename T>
+double primal(const std::complex<T>& x) { return primal(x.real()); }
+
+// What has been spent so far in a solve under a StoppingCriteria, and the best point seen.
+struct BudgetState {
+    const StoppingCriteria& criteria;
+    bool fixedPoint = false;            // f is g of a fixed-point problem, the residual is g(x) - x
+    long evaluations = 0;
+    double bestX = std::numeric_limits<double>::quiet_NaN();
+    double bestResidual = std::numeric_limits<double>::infinity();
+    bool exhausted = false;
+    bool satisfied = false;
+
+    void record(double x, double y) {
+        double residual = fixedPoint ? y - x : y;
+        evaluations++;
+        if (!(std::abs(residual) >= std::abs(bestResidual))) {
+            bestX = x;
+            bestResidual = residual;
+        }
+        satisfied = satisfied || std::abs(residual) <= criteria.residualTolerance;
+        exhausted = exhausted || evaluations >= criteria.maxEvaluations
+                    || (criteria.deadline != StoppingCriteria::Clock::time_point::max()
+                        && StoppingCriteria::Clock::now() >= criteria.deadline);
+    }
+};
+
+// f counting its evaluations in a BudgetState; generic over the argument type when f is.
+template <typename F>
+struct BudgetedObjective {
+    F& f;
+    BudgetState& state;
+
+    template <typename X>
+    auto operator()(X x) -> decltype(f(x)) {
+        auto y = f(x);
+        state.record(primal(x), primal(y));
+        return y;
+    }
+};
+
+// Forwards to the caller's observer and asks the solver to stop when the budget says so.
+template <typename Observer>
+struct BudgetObserver {
+    Observer& observer;
+    BudgetState& state;
+
+    void on_start(std::initializer_list<IterationColumn> columns) { observer.on_start(columns); }
+    void on_start(const char* solver, std::initializer_list<IterationColumn> columns) {
+        detail::start_table(observer, solver, columns);
+    }
+    void on_iteration(int i, std::initializer_list<double> values) { observer.on_iteration(i, values); }
+    void on_converged(double p) { observer.on_converged(p); }
+    bool stop_requested() const { return state.exhausted || state.satisfied || detail::stop_requested(observer); }
+};
+
+/**
+ * Runs `solve(objective, observer)`, a try_ solver call on the wrapped objective and observer, under
+ * `criteria`, and turns a stop requested by the budget into `Converged` (residual criterion met) or
+ * `BudgetExceeded` with the best iterate.
+ */
+template <typename F, typename Observer, typename Solve>
+SolveResult solve_with_criteria(F& f, const StoppingCriteria& criteria, bool fixedPoint, Observer& observer,
+                                Solve&& solve) {
+    BudgetState state{criteria, fixedPoint};
+    BudgetedObjective<F> objective{f, state};
+    BudgetObserver<Observer> budgetObserver{observer, state};
+    SolveResult result = solve(objective, budgetObserver);
+    if (result.status == SolveStatus::Cancelled && (state.satisfied || state.exhausted)) {
+        result.root = state.bestX;
+        result.fRoot = state.bestResidual;
+        result.status = state.satisfied ? SolveStatus::Converged : SolveStatus::BudgetExceeded;
+    }
+    return result;
+}
+
+} // namespace detail
+
+#endif //STOPPING_CRITERIA_H
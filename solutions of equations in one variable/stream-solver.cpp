@@ -0,0 +1,154 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "stream-solver.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr char inputMagic[8] = {'N', 'A', 'S', 'T', 'R', 'I', 'N', '1'};
+constexpr char outputMagic[8] = {'N', 'A', 'S', 'T', 'O', 'U', 'T', '1'};
+constexpr std::size_t headerSize = 64;
+
+static_assert(sizeof(SolveStatus) == sizeof(std::int32_t) && sizeof(int) == sizeof(std::int32_t),
+              "The stream output stores SolveStatus and iteration counts as 32-bit integers.");
+
+struct InputHeader {
+    char magic[8];
+    std::uint64_t records;
+    std::uint32_t parameterColumns;
+    std::uint32_t boundColumns;
+    std::uint32_t blockSize;
+};
+
+struct OutputHeader {
+    char magic[8];
+    std::uint64_t records;
+};
+
+std::size_t output_size(std::size_t records) {
+    return headerSize + records * (sizeof(double) + sizeof(SolveStatus) + sizeof(int));
+}
+
+} // namespace
+
+std::size_t StreamLayout::block_records(std::size_t block) const {
+    const std::uint64_t first = std::uint64_t(block) * blockSize;
+    return static_cast<std::size_t>(records - first < blockSize ? records - first : blockSize);
+}
+
+std::size_t StreamLayout::block_offset(std::size_t block) const {
+    return headerSize + block * std::size_t(blockSize) * columns() * sizeof(double);
+}
+
+std::size_t StreamLayout::file_size() const {
+    // The last block is only as long as the records it holds
+    const std::size_t blocks = block_count();
+    return blocks == 0 ? headerSize : block_offset(blocks - 1) + block_records(blocks - 1) * columns() * sizeof(double);
+}
+
+StreamInput::StreamInput(const std::string& path) : file(MappedFile::open_read(path)) {
+    InputHeader header;
+    if (file.size() < headerSize) {
+        throw std::runtime_error(path + " is not a stream input file.");
+    }
+    std::memcpy(&header, file.data(), sizeof header);
+    if (std::memcmp(header.magic, inputMagic, sizeof inputMagic) != 0 || header.blockSize == 0
+        || header.boundColumns == 0) {
+        throw std::runtime_error(path + " is not a stream input file.");
+    }
+    streamLayout = {header.records, header.parameterColumns, header.boundColumns, header.blockSize};
+    if (file.size() < streamLayout.file_size()) {
+        throw std::runtime_error(path + " is shorter than its header says.");
+    }
+}
+
+StreamBlock StreamInput::block(std::size_t block) const {
+    return {block, block * streamLayout.blockSize, streamLayout.block_records(block), streamLayout.parameterColumns,
+            reinterpret_cast<const double*>(file.data() + streamLayout.block_offset(block))};
+}
+
+void StreamInput::prefetch(std::size_t block) const {
+    if (block < streamLayout.block_count()) {
+        file.prefetch(streamLayout.block_offset(block), streamLayout.block_records(block) * streamLayout.columns() * sizeof(double));
+    }
+}
+
+void StreamInput::release(std::size_t block) const {
+    file.release(streamLayout.block_offset(block), streamLayout.block_records(block) * streamLayout.columns() * sizeof(double));
+}
+
+StreamInputWriter::StreamInputWriter(const std::string& path, const StreamLayout& layout)
+    : streamLayout(layout) {
+    if (layout.blockSize == 0 || layout.boundColumns == 0) {
+        throw std::invalid_argument("A stream needs at least one bound column and one record per block.");
+    }
+    file = MappedFile::create(path, layout.file_size());
+
+    InputHeader header{};
+    std::memcpy(header.magic, inputMagic, sizeof inputMagic);
+    header.records = layout.records;
+    header.parameterColumns = layout.parameterColumns;
+    header.boundColumns = layout.boundColumns;
+    header.blockSize = layout.blockSize;
+    std::memcpy(file.data(), &header, sizeof header);
+}
+
+WritableStreamBlock StreamInputWriter::block(std::size_t block) {
+    return {block, block * streamLayout.blockSize, streamLayout.block_records(block), streamLayout.parameterColumns,
+            reinterpret_cast<double*>(file.data() + streamLayout.block_offset(block))};
+}
+
+void StreamInputWriter::release(std::size_t block) const {
+    file.release(streamLayout.block_offset(block), streamLayout.block_records(block) * streamLayout.columns() * sizeof(double));
+}
+
+StreamOutput::StreamOutput(const std::string& path, std::size_t records)
+    : file(MappedFile::create(path, output_size(records))), recordCount(records) {
+    OutputHeader header{};
+    std::memcpy(header.magic, outputMagic, sizeof outputMagic);
+    header.records = records;
+    std::memcpy(file.data(), &header, sizeof header);
+}
+
+BatchResults StreamOutput::results(std::size_t first, std::size_t count) {
+    std::byte* data = file.data() + headerSize;
+    auto* roots = reinterpret_cast<double*>(data);
+    auto* status = reinterpret_cast<SolveStatus*>(data + recordCount * sizeof(double));
+    auto* iterations = reinterpret_cast<int*>(data + recordCount * (sizeof(double) + sizeof(SolveStatus)));
+    return {{roots + first, count}, {status + first, count}, {iterations + first, count}};
+}
+
+void StreamOutput::release(std::size_t first, std::size_t count) const {
+    file.release(headerSize + first * sizeof(double), count * sizeof(double));
+    file.release(headerSize + recordCount * sizeof(double) + first * sizeof(SolveStatus), count * sizeof(SolveStatus));
+    file.release(headerSize + recordCount * (sizeof(double) + sizeof(SolveStatus)) + first * sizeof(int), count * sizeof(int));
+}
+
+StreamResults::StreamResults(const std::string& path) : file(MappedFile::open_read(path)) {
+    OutputHeader header;
+    if (file.size() < headerSize) {
+        throw std::runtime_error(path + " is not a stream output file.");
+    }
+    std::memcpy(&header, file.data(), sizeof header);
+    if (std::memcmp(header.magic, outputMagic, sizeof outputMagic) != 0
+        || file.size() < output_size(static_cast<std::size_t>(header.records))) {
+        throw std::runtime_error(path + " is not a stream output file.");
+    }
+    recordCount = static_cast<std::size_t>(header.records);
+}
+
+std::span<const double> StreamResults::roots() const {
+    return {reinterpret_cast<const double*>(file.data() + headerSize), recordCount};
+}
+
+std::span<const SolveStatus> StreamResults::status() const {
+    return {reinterpret_cast<const SolveStatus*>(file.data() + headerSize + recordCount * sizeof(double)), recordCount};
+}
+
+std::span<const int> StreamResults::iterations() const {
+    return {reinterpret_cast<const int*>(file.data() + headerSize + recordCount * (sizeof(double) + sizeof(SolveStatus))),
+            recordCount};
+}
@@ -0,0 +1,292 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef STREAM_SOLVER_H
+#define STREAM_SOLVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "batch-solvers.h"
+#include "mapped-file.h"
+#include "solve-result.h"
+
+// Streaming batch solves over memory-mapped binary files, for inputs far larger than memory.
+//
+// The input is a columnar file of records, each made of `parameterColumns` parameters of the
+// objective followed by `boundColumns` start values (1: an initial guess, 2: a bracket). Records are
+// stored in blocks of `blockSize`, and inside a block column by column, so a block is one contiguous
+// range holding the SoA arrays the batch engine (batch-solvers.h) works on:
+//
+//     header (64 bytes): "NASTRIN1", u64 records, u32 parameterColumns, u32 boundColumns, u32 blockSize
+//     block 0: column 0 [blockSize doubles], column 1 [blockSize doubles], ...
+//     block 1: ...                                                  (the last block may be shorter)
+//
+// The output file holds the roots, SolveStatus codes and iteration counts as three arrays over all
+// records, which the batch solvers write into directly through the mapping:
+//
+//     header (64 bytes): "NASTOUT1", u64 records
+//     roots [records doubles], status [records int32], iterations [records int32]
+//
+// run_stream() goes through the file block by block: it asks the operating system to read the next
+// block in the background, solves the current one straight from the mapping into the mapped output,
+// and hands the pages of both back afterwards. Address space is reserved for the whole files, but
+// the resident set stays at about two input blocks and one output block whatever the file size.
+// Both files use the byte order of the machine.
+//
+// The objective of the stream solvers is called as `f(record, x)`, where `record[c]` is parameter c
+// of the record being solved:
+//
+//     stream_newton_raphson_solver("cubics.bin", "roots.bin",
+//                                  [](const StreamRecord& p, auto x) { return x * x * x + p[0] * x + p[1]; });
+
+// Default number of records per block: 512 KiB per column.
+inline constexpr std::uint32_t streamBlockSize = 65536;
+
+// Shape of a stream input file, and where its blocks are.
+struct StreamLayout {
+    std::uint64_t records = 0;
+    std::uint32_t parameterColumns = 0;
+    std::uint32_t boundColumns = 1;
+    std::uint32_t blockSize = streamBlockSize;
+
+    std::size_t columns() const { return std::size_t(parameterColumns) + boundColumns; }
+    std::size_t block_count() const { return static_cast<std::size_t>((records + blockSize - 1) / blockSize); }
+    std::size_t block_records(std::size_t block) const;
+    std::size_t block_offset(std::size_t block) const;
+    std::size_t file_size() const;
+};
+
+// One record of a stream block as seen by the objective.
+class StreamRecord {
+public:
+    StreamRecord(const double* first, std::size_t stride) : first(first), stride(stride) {}
+
+    // Parameter `column` of the record.
+    double operator[](std::size_t column) const { return first[column * stride]; }
+
+private:
+    const double* first;
+    std::size_t stride;
+};
+
+// View of one block: the SoA columns of records [first, first + size).
+template <typename Value>
+struct BasicStreamBlock {
+    std::size_t index = 0;
+    std::size_t first = 0;
+    std::size_t size = 0;
+    std::size_t parameterColumns = 0;
+    Value* data = nullptr;
+
+    std::span<Value> parameter(std::size_t column) const { return {data + column * size, size}; }
+    std::span<Value> bound(std::size_t column) const { return {data + (parameterColumns + column) * size, size}; }
+    StreamRecord record(std::size_t i) const { return {data + i, size}; }
+};
+
+using StreamBlock = BasicStreamBlock<const double>;
+using WritableStreamBlock = BasicStreamBlock<double>;
+
+/**
+ * @brief A stream input file, mapped read-only.
+ *
+ * @throws std::system_error If the file cannot be opened or mapped.
+ * @throws std::runtime_error If it is not a stream input file or is shorter than its header says.
+ */
+class StreamInput {
+public:
+    explicit StreamInput(const std::string& path);
+
+    const StreamLayout& layout() const { return streamLayout; }
+    StreamBlock block(std::size_t block) const;
+
+    // Starts reading `block` in the background; out-of-range blocks are ignored.
+    void prefetch(std::size_t block) const;
+    // Drops the pages of `block` from memory.
+    void release(std::size_t block) const;
+
+private:
+    MappedFile file;
+    StreamLayout streamLayout;
+};
+
+/**
+ * @brief Creates a stream input file with the given layout, to be filled block by block.
+ *
+ * Fill the columns of every block(), release() it and call flush() at the end; the file is
+ * complete when the writer is destroyed.
+ *
+ * @throws std::system_error If the file cannot be created or mapped.
+ */
+class StreamInputWriter {
+public:
+    StreamInputWriter(const std::string& path, const StreamLayout& layout);
+
+    const StreamLayout& layout() const { return streamLayout; }
+    WritableStreamBlock block(std::size_t block);
+    void release(std::size_t block) const;
+    void flush() const { file.flush(); }
+
+private:
+    MappedFile file;
+    StreamLayout streamLayout;
+};
+
+/**
+ * @brief A stream output file for `records` results, mapped read-write.
+ *
+ * @throws std::system_error If the file cannot be created or mapped.
+ */
+class StreamOutput {
+public:
+    StreamOutput(const std::string& path, std::size_t records);
+
+    std::size_t records() const { return recordCount; }
+
+    // Output spans of records [first, first + count), pointing into the mapping.
+    BatchResults results(std::size_t first, std::size_t count);
+    // Drops the pages of records [first, first + count) from memory; they stay in the file.
+    void release(std::size_t first, std::size_t count) const;
+    void flush() const { file.flush(); }
+
+private:
+    MappedFile file;
+    std::size_t recordCount;
+};
+
+/**
+ * @brief A stream output file, mapped read-only for the jobs consuming the roots.
+ *
+ * @throws std::system_error If the file cannot be opened or mapped.
+ * @throws std::runtime_error If it is not a stream output file.
+ */
+class StreamResults {
+public:
+    explicit StreamResults(const std::string& path);
+
+    std::size_t records() const { return recordCount; }
+    std::span<const double> roots() const;
+    std::span<const SolveStatus> status() const;
+    std::span<const int> iterations() const;
+
+private:
+    MappedFile file;
+    std::size_t recordCount = 0;
+};
+
+// Outcome of a streaming solve.
+struct StreamReport {
+    std::size_t records = 0;
+    std::size_t blocks = 0;
+    std::size_t converged = 0;
+};
+
+/**
+ * @brief Solves every block of `input` into `output` with `solveBlock(block, results)`.
+ *
+ * `solveBlock` receives a StreamBlock and the BatchResults of its records in the output mapping,
+ * and returns the number of converged records, as the batch solvers do. The next block is
+ * prefetched before the current one is solved, and both are released after it.
+ *
+ * @throws std::invalid_argument If `output` does not have one record per input record.
+ */
+template <typename SolveBlock>
+StreamReport run_stream(const StreamInput& input, StreamOutput& output, SolveBlock&& solveBlock) {
+    const StreamLayout& layout = input.layout();
+    if (output.records() != layout.records) {
+        throw std::invalid_argument("The stream output must have one record per input record.");
+    }
+
+    StreamReport report;
+    report.records = static_cast<std::size_t>(layout.records);
+    report.blocks = layout.block_count();
+    for (std::size_t b = 0; b < report.blocks; b++) {
+        input.prefetch(b + 1);
+        StreamBlock block = input.block(b);
+        report.converged += solveBlock(block, output.results(block.first, block.size));
+        input.release(b);
+        output.release(block.first, block.size);
+    }
+    output.flush();
+    return report;
+}
+
+namespace detail {
+
+inline void check_bound_columns(const StreamInput& input, std::uint32_t boundColumns) {
+    if (input.layout().boundColumns != boundColumns) {
+        throw std::invalid_argument(boundColumns == 2 ? "The method requires a bracket (two bound columns) per record."
+                                                      : "The method requires an initial guess (one bound column) per record.");
+    }
+}
+
+// The objective of a block in the `f(i, x)` form of the batch engine
+template <typename F>
+auto block_objective(F& f, const StreamBlock& block) {
+    return [&f, block](std::size_t i, auto x) -> decltype(f(block.record(i), x)) { return f(block.record(i), x); };
+}
+
+} // namespace detail
+
+/**
+ * @brief batch_bisection_solver() over a stream input file with brackets, writing `outputPath`.
+ *
+ * @param f The objective, called as `f(record, x)`.
+ * @throws std::invalid_argument If the records do not hold a bracket.
+ * @throws std::system_error If a file cannot be opened, created or mapped.
+ */
+template <std::size_t Lanes = batchLaneWidth, typename F>
+StreamReport stream_bisection_solver(const std::string& inputPath, const std::string& outputPath, F&& f,
+                                     double tolerance = 1e-6, int maxIterations = 1000000) {
+    StreamInput input(inputPath);
+    detail::check_bound_columns(input, 2);
+    StreamOutput output(outputPath, static_cast<std::size_t>(input.layout().records));
+    return run_stream(input, output, [&](const StreamBlock& block, const BatchResults& results) {
+        return batch_bisection_solver<Lanes>(block.bound(0), block.bound(1), detail::block_objective(f, block), results,
+                                             tolerance, maxIterations);
+    });
+}
+
+/**
+ * @brief batch_false_position_solver() over a stream input file with brackets, writing `outputPath`.
+ *
+ * @param f The objective, called as `f(record, x)`.
+ * @throws std::invalid_argument If the records do not hold a bracket.
+ * @throws std::system_error If a file cannot be opened, created or mapped.
+ */
+template <std::size_t Lanes = batchLaneWidth, typename F>
+StreamReport stream_false_position_solver(const std::string& inputPath, const std::string& outputPath, F&& f,
+                                          double tolerance = 1e-6, int maxIterations = 1000000) {
+    StreamInput input(inputPath);
+    detail::check_bound_columns(input, 2);
+    StreamOutput output(outputPath, static_cast<std::size_t>(input.layout().records));
+    return run_stream(input, output, [&](const StreamBlock& block, const BatchResults& results) {
+        return batch_false_position_solver<Lanes>(block.bound(0), block.bound(1), detail::block_objective(f, block),
+                                                  results, tolerance, maxIterations);
+    });
+}
+
+/**
+ * @brief batch_newton_raphson_solver() over a stream input file with initial guesses, writing `outputPath`.
+ *
+ * @param f The objective, called as `f(record, x)`; generic objectives get exact dual-number derivatives.
+ * @throws std::invalid_argument If the records do not hold one initial guess.
+ * @throws std::system_error If a file cannot be opened, created or mapped.
+ */
+template <std::size_t Lanes = batchLaneWidth, typename F>
+StreamReport stream_newton_raphson_solver(const std::string& inputPath, const std::string& outputPath, F&& f,
+                                          double tolerance = 1e-6, int maxIterations = 1000000) {
+    StreamInput input(inputPath);
+    detail::check_bound_columns(input, 1);
+    StreamOutput output(outputPath, static_cast<std::size_t>(input.layout().records));
+    return run_stream(input, output, [&](const StreamBlock& block, const BatchResults& results) {
+        return batch_newton_raphson_solver<Lanes>(block.bound(0), detail::block_objective(f, block), results, tolerance,
+                                                  maxIterations);
+    });
+}
+
+#endif //STREAM_SOLVER_H
@@ -0,0 +1,291 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef TAYLOR_JET_H
+#define TAYLOR_JET_H
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief Truncated Taylor series of degree N, for higher-order forward-mode differentiation.
+ *
+ * `c[k]` holds f^(k)(x) / k!. Evaluating an objective at `Jet<T, N>::variable(x)` propagates the
+ * series through every operation, so one evaluation yields f(x), f'(x), ..., f^(N)(x) exactly to
+ * rounding (read them with derivative(k)). It generalizes Dual<T>, which is the case N = 1, and
+ * works with the same generic objectives:
+ *
+ *     auto f = [](auto x) { using std::exp; return exp(x) - 3 * x; };
+ *
+ * As for Dual there is no conversion back to T, and comparisons look at the value only.
+ */
+template <typename T, std::size_t N>
+struct Jet {
+    std::array<T, N + 1> c{};
+
+    constexpr Jet() = default;
+    constexpr Jet(T value) { c[0] = value; }
+
+    // The independent variable x, i.e. x + 1·h.
+    static constexpr Jet variable(T x) {
+        Jet jet(x);
+        if constexpr (N > 0) {
+            jet.c[1] = T(1);
+        }
+        return jet;
+    }
+
+    constexpr T value() const { return c[0]; }
+
+    // The k-th derivative, k! · c[k].
+    constexpr T derivative(std::size_t k) const {
+        T factorial = 1;
+        for (std::size_t i = 2; i <= k; i++) {
+            factorial *= T(i);
+        }
+        return factorial * c[k];
+    }
+
+    constexpr Jet& operator+=(const Jet& other) { return *this = *this + other; }
+    constexpr Jet& operator-=(const Jet& other) { return *this = *this - other; }
+    constexpr Jet& operator*=(const Jet& other) { return *this = *this * other; }
+    constexpr Jet& operator/=(const Jet& other) { return *this = *this / other; }
+
+    friend constexpr Jet operator+(const Jet& x) { return x; }
+    friend constexpr Jet operator-(const Jet& x) {
+        Jet y;
+        for (std::size_t k = 0; k <= N; k++) y.c[k] = -x.c[k];
+        return y;
+    }
+    friend constexpr Jet operator+(const Jet& x, const Jet& y) {
+        Jet z;
+        for (std::size_t k = 0; k <= N; k++) z.c[k] = x.c[k] + y.c[k];
+        return z;
+    }
+    friend constexpr Jet operator-(const Jet& x, const Jet& y) {
+        Jet z;
+        for (std::size_t k = 0; k <= N; k++) z.c[k] = x.c[k] - y.c[k];
+        return z;
+    }
+    // Cauchy product of the two series
+    friend constexpr Jet operator*(const Jet& x, const Jet& y) {
+        Jet z;
+        for (std::size_t k = 0; k <= N; k++) {
+            for (std::size_t j = 0; j <= k; j++) z.c[k] += x.c[j] * y.c[k - j];
+        }
+        return z;
+    }
+    // z = x / y solves z * y = x term by term
+    friend constexpr Jet operator/(const Jet& x, const Jet& y) {
+        Jet z;
+        for (std::size_t k = 0; k <= N; k++) {
+            T sum = x.c[k];
+            for (std::size_t j = 1; j <= k; j++) sum -= y.c[j] * z.c[k - j];
+            z.c[k] = sum / y.c[0];
+        }
+        return z;
+    }
+
+    friend constexpr bool operator==(const Jet& x, const Jet& y) { return x.c[0] == y.c[0]; }
+    friend constexpr auto operator<=>(const Jet& x, const Jet& y) { return x.c[0] <=> y.c[0]; }
+};
+
+// Mixed arithmetic with plain numbers
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator+(const Jet<T, N>& x, S y) { Jet<T, N> z = x; z.c[0] += T(y); return z; }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator+(S x, const Jet<T, N>& y) { return y + x; }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator-(const Jet<T, N>& x, S y) { Jet<T, N> z = x; z.c[0] -= T(y); return z; }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator-(S x, const Jet<T, N>& y) { return -y + x; }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator*(const Jet<T, N>& x, S y) {
+    Jet<T, N> z = x;
+    for (T& coefficient : z.c) coefficient *= T(y);
+    return z;
+}
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator*(S x, const Jet<T, N>& y) { return y * x; }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator/(const Jet<T, N>& x, S y) {
+    Jet<T, N> z = x;
+    for (T& coefficient : z.c) coefficient /= T(y);
+    return z;
+}
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr Jet<T, N> operator/(S x, const Jet<T, N>& y) { return Jet<T, N>(T(x)) / y; }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr bool operator==(const Jet<T, N>& x, S y) { return x.c[0] == T(y); }
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+constexpr auto operator<=>(const Jet<T, N>& x, S y) { return x.c[0] <=> T(y); }
+
+namespace detail {
+
+// Series of y with y' = z · x' and y(x0) = y0, the common recurrence k·y_k = Σ j·x_j·z_{k-j} of the
+// elementary functions.
+template <typename T, std::size_t N>
+Jet<T, N> integrate_series(T y0, const Jet<T, N>& x, const Jet<T, N>& z) {
+    Jet<T, N> y(y0);
+    for (std::size_t k = 1; k <= N; k++) {
+        T sum = 0;
+        for (std::size_t j = 1; j <= k; j++) sum += T(j) * x.c[j] * z.c[k - j];
+        y.c[k] = sum / T(k);
+    }
+    return y;
+}
+
+// x^r for a scalar exponent, with the given value of x0^r
+template <typename T, std::size_t N>
+Jet<T, N> power_series(const Jet<T, N>& x, T r, T value) {
+    Jet<T, N> p(value);
+    for (std::size_t k = 1; k <= N; k++) {
+        T sum = 0;
+        for (std::size_t j = 1; j <= k; j++) sum += (r * T(j) - T(k - j)) * x.c[j] * p.c[k - j];
+        p.c[k] = sum / (T(k) * x.c[0]);
+    }
+    return p;
+}
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+Jet<T, N> exp(const Jet<T, N>& x) {
+    Jet<T, N> y(std::exp(x.c[0]));
+    for (std::size_t k = 1; k <= N; k++) {
+        T sum = 0;
+        for (std::size_t j = 1; j <= k; j++) sum += T(j) * x.c[j] * y.c[k - j];
+        y.c[k] = sum / T(k);
+    }
+    return y;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> log(const Jet<T, N>& x) {
+    Jet<T, N> y(std::log(x.c[0]));
+    for (std::size_t k = 1; k <= N; k++) {
+        T sum = 0;
+        for (std::size_t j = 1; j < k; j++) sum += T(j) * y.c[j] * x.c[k - j];
+        y.c[k] = (x.c[k] - sum / T(k)) / x.c[0];
+    }
+    return y;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> sqrt(const Jet<T, N>& x) {
+    Jet<T, N> y(std::sqrt(x.c[0]));
+    for (std::size_t k = 1; k <= N; k++) {
+        T sum = x.c[k];
+        for (std::size_t j = 1; j < k; j++) sum -= y.c[j] * y.c[k - j];
+        y.c[k] = sum / (2 * y.c[0]);
+    }
+    return y;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> cbrt(const Jet<T, N>& x) {
+    return detail::power_series(x, T(1) / T(3), std::cbrt(x.c[0]));
+}
+
+template <typename T, std::size_t N, typename S> requires std::is_arithmetic_v<S>
+Jet<T, N> pow(const Jet<T, N>& x, S exponent) {
+    return detail::power_series(x, T(exponent), std::pow(x.c[0], T(exponent)));
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> pow(const Jet<T, N>& x, const Jet<T, N>& exponent) {
+    return exp(exponent * log(x));
+}
+
+namespace detail {
+
+// sin and cos of x together, their recurrences are coupled
+template <typename T, std::size_t N>
+void sin_cos(const Jet<T, N>& x, Jet<T, N>& s, Jet<T, N>& c) {
+    s = Jet<T, N>(std::sin(x.c[0]));
+    c = Jet<T, N>(std::cos(x.c[0]));
+    for (std::size_t k = 1; k <= N; k++) {
+        T sumS = 0, sumC = 0;
+        for (std::size_t j = 1; j <= k; j++) {
+            sumS += T(j) * x.c[j] * c.c[k - j];
+            sumC += T(j) * x.c[j] * s.c[k - j];
+        }
+        s.c[k] = sumS / T(k);
+        c.c[k] = -sumC / T(k);
+    }
+}
+
+} // namespace detail
+
+template <typename T, std::size_t N>
+Jet<T, N> sin(const Jet<T, N>& x) {
+    Jet<T, N> s, c;
+    detail::sin_cos(x, s, c);
+    return s;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> cos(const Jet<T, N>& x) {
+    Jet<T, N> s, c;
+    detail::sin_cos(x, s, c);
+    return c;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> tan(const Jet<T, N>& x) {
+    Jet<T, N> s, c;
+    detail::sin_cos(x, s, c);
+    return s / c;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> atan(const Jet<T, N>& x) {
+    return detail::integrate_series(std::atan(x.c[0]), x, 1 / (1 + x * x));
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> asin(const Jet<T, N>& x) {
+    return detail::integrate_series(std::asin(x.c[0]), x, 1 / sqrt(1 - x * x));
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> acos(const Jet<T, N>& x) {
+    return detail::integrate_series(std::acos(x.c[0]), x, -1 / sqrt(1 - x * x));
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> sinh(const Jet<T, N>& x) {
+    return (exp(x) - exp(-x)) / 2;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> cosh(const Jet<T, N>& x) {
+    return (exp(x) + exp(-x)) / 2;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> tanh(const Jet<T, N>& x) {
+    return sinh(x) / cosh(x);
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> abs(const Jet<T, N>& x) {
+    return x.c[0] < 0 ? -x : x;
+}
+
+template <typename T, std::size_t N>
+Jet<T, N> fabs(const Jet<T, N>& x) {
+    return abs(x);
+}
+
+// True when f can be evaluated on Jet<double, N>, i.e. when one evaluation can give its first N derivatives.
+template <typename F, std::size_t N>
+concept JetDifferentiable = requires(F& f, Jet<double, N> x) {
+    { f(x) } -> std::same_as<Jet<double, N>>;
+};
+
+#endif //TAYLOR_JET_H
@@ -0,0 +1,180 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#include "work-stealing-pool.h"
+
+#include <algorithm>
+#include <chrono>
+
+// Chunk range and statistics owned by one worker. Padded to a cache line so that workers popping
+// from their own range do not invalidate each other's lines.
+struct alignas(64) WorkStealingPool::WorkerSlot {
+    std::mutex mutex;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    WorkerStats stats;
+};
+
+WorkStealingPool::WorkStealingPool(std::size_t threadCount)
+    : workerCount(std::max<std::size_t>(threadCount, 1)), slots(new WorkerSlot[workerCount]) {
+    threads.reserve(workerCount - 1);
+    for (std::size_t worker = 1; worker < workerCount; worker++) {
+        threads.emplace_back([this, worker] { worker_loop(worker); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+std::vector<WorkerStats> WorkStealingPool::last_run_stats() const {
+    std::vector<WorkerStats> stats;
+    last_run_stats(stats);
+    return stats;
+}
+
+void WorkStealingPool::last_run_stats(std::vector<WorkerStats>& stats) const {
+    stats.resize(workerCount);
+    for (std::size_t worker = 0; worker < workerCount; worker++) {
+        stats[worker] = slots[worker].stats;
+    }
+}
+
+void WorkStealingPool::run(std::size_t count, std::size_t grain, ChunkFunction function, void* context) {
+    std::lock_guard<std::mutex> runLock(runMutex);
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    const std::size_t chunkCount = (count + grain - 1) / grain;
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        jobFunction = function;
+        jobContext = context;
+        jobCount = count;
+        jobGrain = grain;
+        jobError = nullptr;
+        jobFailed.store(false, std::memory_order_relaxed);
+        // Every worker starts with an equal contiguous share of the chunks
+        for (std::size_t worker = 0; worker < workerCount; worker++) {
+            std::lock_guard<std::mutex> slotLock(slots[worker].mutex);
+            slots[worker].begin = chunkCount * worker / workerCount;
+            slots[worker].end = chunkCount * (worker + 1) / workerCount;
+            slots[worker].stats = WorkerStats{};
+        }
+        pendingWorkers = workerCount - 1;
+        generation++;
+    }
+    wakeWorkers.notify_all();
+
+    auto start = std::chrono::steady_clock::now();
+    work(0);
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        workersDone.wait(lock, [this] { return pendingWorkers == 0; });
+    }
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (std::size_t worker = 0; worker < workerCount; worker++) {
+        WorkerStats& stats = slots[worker].stats;
+        stats.utilization = wallSeconds > 0 ? std::min(stats.busySeconds / wallSeconds, 1.0) : 1.0;
+    }
+    if (jobError) {
+        std::rethrow_exception(jobError);
+    }
+}
+
+void WorkStealingPool::worker_loop(std::size_t worker) {
+    std::size_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            wakeWorkers.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+        }
+        work(worker);
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (--pendingWorkers == 0) {
+                workersDone.notify_one();
+            }
+        }
+    }
+}
+
+void WorkStealingPool::work(std::size_t worker) {
+    WorkerStats& stats = slots[worker].stats;
+    for (;;) {
+        std::size_t chunk;
+        if (!pop_chunk(worker, chunk)) {
+            if (!steal_chunks(worker)) {
+                return;
+            }
+            continue;
+        }
+        if (jobFailed.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        std::size_t begin = chunk * jobGrain;
+        std::size_t end = std::min(begin + jobGrain, jobCount);
+        auto start = std::chrono::steady_clock::now();
+        try {
+            jobFunction(jobContext, begin, end, worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (!jobFailed.exchange(true)) {
+                jobError = std::current_exception();
+            }
+        }
+        stats.busySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        stats.chunks++;
+    }
+}
+
+bool WorkStealingPool::pop_chunk(std::size_t worker, std::size_t& chunk) {
+    WorkerSlot& slot = slots[worker];
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    if (slot.begin == slot.end) {
+        return false;
+    }
+    chunk = slot.begin++;
+    return true;
+}
+
+bool WorkStealingPool::steal_chunks(std::size_t worker) {
+    for (std::size_t offset = 1; offset < workerCount; offset++) {
+        WorkerSlot& victim = slots[(worker + offset) % workerCount];
+        std::size_t begin, end;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            std::size_t remaining = victim.end - victim.begin;
+            if (remaining == 0) {
+                continue;
+            }
+            // Take the back half, the victim keeps working on the front
+            end = victim.end;
+            begin = end - (remaining + 1) / 2;
+            victim.end = begin;
+        }
+        WorkerSlot& own = slots[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.begin = begin;
+        own.end = end;
+        own.stats.steals++;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,98 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// What one worker did during the last WorkStealingPool::parallel_for().
+struct WorkerStats {
+    std::size_t chunks = 0;     // chunks executed
+    std::size_t steals = 0;     // successful steals from other workers
+    double busySeconds = 0;     // time spent inside the loop body
+    double utilization = 0;     // busySeconds divided by the wall time of the run
+};
+
+/**
+ * @brief Fixed-size thread pool running index ranges with work stealing.
+ *
+ * parallel_for() cuts [0, count) into chunks of `grain` indices and hands every worker an equal
+ * contiguous share of the chunks. A worker takes chunks from the front of its own share and, once
+ * it runs dry, steals the back half of the share of another worker. Workloads whose chunks take
+ * very different times (Newton converging in 3 or in 300 iterations) therefore keep every core
+ * busy until the end, which static partitioning does not.
+ *
+ * The calling thread takes part as worker 0. parallel_for() calls are serialized and must not be
+ * nested inside the body of another parallel_for() on the same pool.
+ */
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(std::size_t threadCount = std::thread::hardware_concurrency());
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t thread_count() const { return workerCount; }
+
+    /**
+     * @brief Runs `body(begin, end, worker)` for every chunk of [0, count) and waits for all of them.
+     *
+     * `worker` is the index (0 .. thread_count() - 1) of the thread running the chunk, suitable for
+     * indexing per-thread buffers. If the body throws, the remaining chunks are skipped and the
+     * first exception is rethrown in the caller.
+     */
+    template <typename Body>
+    void parallel_for(std::size_t count, std::size_t grain, Body&& body) {
+        using BodyType = std::remove_reference_t<Body>;
+        run(count, grain, [](void* context, std::size_t begin, std::size_t end, std::size_t worker) {
+            (*static_cast<BodyType*>(context))(begin, end, worker);
+        }, const_cast<void*>(static_cast<const void*>(&body)));
+    }
+
+    // Per-worker statistics of the last parallel_for(), indexed by worker.
+    std::vector<WorkerStats> last_run_stats() const;
+    // The same into `stats`, reusing its storage.
+    void last_run_stats(std::vector<WorkerStats>& stats) const;
+
+private:
+    using ChunkFunction = void (*)(void*, std::size_t, std::size_t, std::size_t);
+    struct WorkerSlot;
+
+    void run(std::size_t count, std::size_t grain, ChunkFunction function, void* context);
+    void worker_loop(std::size_t worker);
+    void work(std::size_t worker);
+    bool pop_chunk(std::size_t worker, std::size_t& chunk);
+    bool steal_chunks(std::size_t worker);
+
+    std::size_t workerCount;
+    std::unique_ptr<WorkerSlot[]> slots;
+    std::vector<std::thread> threads;
+
+    std::mutex runMutex;                // serializes parallel_for() calls
+    std::mutex stateMutex;
+    std::condition_variable wakeWorkers;
+    std::condition_variable workersDone;
+    std::size_t generation = 0;
+    std::size_t pendingWorkers = 0;
+    bool stopping = false;
+
+    ChunkFunction jobFunction = nullptr;
+    void* jobContext = nullptr;
+    std::size_t jobCount = 0;
+    std::size_t jobGrain = 1;
+    std::exception_ptr jobError;
+    std::atomic<bool> jobFailed = false;
+};
+
+#endif //WORK_STEALING_POOL_H
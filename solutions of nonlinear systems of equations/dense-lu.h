@@ -0,0 +1,97 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef DENSE_LU_H
+#define DENSE_LU_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+
+// Dense LU factorization with partial pivoting, for the Jacobians of the nonlinear system solvers.
+//
+// Matrices are n×n, stored row-major in a span of n² doubles, and factored in place: afterwards the
+// strict lower triangle holds L (whose unit diagonal is not stored) and the upper triangle U, with
+// P·A = L·U for the row permutation recorded in `pivots`. Neither function allocates, so a
+// factorization can be kept and reused for many right-hand sides.
+
+/**
+ * @brief Factors the n×n row-major matrix `a` in place into P·A = L·U.
+ *
+ * @param a The matrix, n = pivots.size(); overwritten by its factors.
+ * @param pivots Receives the row swapped with row k at step k.
+ * @return false if the matrix is singular to working precision (a pivot below n·eps times the
+ *         largest entry); the factors are then incomplete and must not be used.
+ */
+inline bool lu_factor(std::span<double> a, std::span<std::size_t> pivots) {
+    const std::size_t n = pivots.size();
+    double scale = 0;
+    for (double v : a.first(n * n)) {
+        scale = std::max(scale, std::abs(v));
+    }
+    const double threshold = static_cast<double>(n) * std::numeric_limits<double>::epsilon() * scale;
+
+    for (std::size_t k = 0; k < n; k++) {
+        std::size_t pivot = k;
+        for (std::size_t i = k + 1; i < n; i++) {
+            if (std::abs(a[i * n + k]) > std::abs(a[pivot * n + k])) {
+                pivot = i;
+            }
+        }
+        pivots[k] = pivot;
+        if (!(std::abs(a[pivot * n + k]) > threshold)) {
+            return false;
+        }
+        if (pivot != k) {
+            std::swap_ranges(a.begin() + k * n, a.begin() + (k + 1) * n, a.begin() + pivot * n);
+        }
+
+        const double inverse = 1 / a[k * n + k];
+        for (std::size_t i = k + 1; i < n; i++) {
+            double l = a[i * n + k] *= inverse;
+            if (l == 0) {
+                continue;
+            }
+            for (std::size_t j = k + 1; j < n; j++) {
+                a[i * n + j] -= l * a[k * n + j];
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Solves A·x = b in place from the factors of lu_factor().
+ *
+ * @param lu The factors of A.
+ * @param pivots The row swaps of the factorization.
+ * @param b The right-hand side on entry, the solution on return.
+ */
+inline void lu_solve(std::span<const double> lu, std::span<const std::size_t> pivots, std::span<double> b) {
+    const std::size_t n = pivots.size();
+    for (std::size_t k = 0; k < n; k++) {
+        std::swap(b[k], b[pivots[k]]);
+    }
+    // L·y = P·b, unit diagonal
+    for (std::size_t i = 1; i < n; i++) {
+        double sum = b[i];
+        for (std::size_t j = 0; j < i; j++) {
+            sum -= lu[i * n + j] * b[j];
+        }
+        b[i] = sum;
+    }
+    // U·x = y
+    for (std::size_t i = n; i-- > 0;) {
+        double sum = b[i];
+        for (std::size_t j = i + 1; j < n; j++) {
+            sum -= lu[i * n + j] * b[j];
+        }
+        b[i] = sum / lu[i * n + i];
+    }
+}
+
+#endif //DENSE_LU_H
@@ -0,0 +1,423 @@
+//
+// Created by Hello on 14.10.2026.
+//
+
+#ifndef NEWTON_SYSTEMS_SOLVER_H
+#define NEWTON_SYSTEMS_SOLVER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../solutions of equations in one variable/dual.h"
+#include "../solutions of equations in one variable/solve-result.h"
+#include "../solutions of equations in one variable/solver-error.h"
+#include "../solutions of equations in one variable/solver-observers.h"
+#include "../solutions of equations in one variable/solver-workspace.h"
+#include "dense-lu.h"
+
+// Newton's method for nonlinear systems F(x) = 0 with x, F(x) in ℝⁿ.
+//
+// The residual is a callable `f(x, fx)` taking `std::span<const double> x` and writing F(x) to
+// `std::span<double> fx`. Written generically over the element type,
+//
+//     auto f = []<typename T>(std::span<const T> x, std::span<T> fx) {
+//         using std::exp;
+//         fx[0] = x[0] * x[0] + x[1] * x[1] - 4;
+//         fx[1] = exp(x[0]) + x[1] - 1;
+//     };
+//
+// it can also be evaluated on dual numbers, which gives the exact Jacobian one column per
+// evaluation (see AutomaticJacobian).
+//
+// Building and factoring the Jacobian costs n evaluations of F and O(n³) operations, usually far
+// more than the rest of an iteration. JacobianReuse chooses how often that is paid:
+//
+//   Newton       a new Jacobian every iteration: quadratic convergence, the most work per iteration.
+//   Chord        the Jacobian of the starting point throughout: linear convergence, one LU solve
+//                (O(n²)) per iteration.
+//   Shamanskii   a new Jacobian every `refreshInterval` iterations, between the two.
+//   Broyden      the first Jacobian corrected by Broyden's rank-1 updates after every step:
+//                superlinear convergence at O(n²) per iteration. The updates are applied in product
+//                form to solves with the kept LU factors (Kelley's algorithm), so no matrix is
+//                updated; the workspace holds up to `maxUpdates` of them.
+//
+// In the reuse modes the Jacobian is rebuilt whenever a step fails to reduce max |F_i|, and in
+// Broyden mode also when the updates run out or break down.
+//
+// All vectors and matrices live in a NewtonSystemWorkspace, allocated before the iteration starts
+// and reusable across solves of the same dimension, so the iterations do not allocate. The overload
+// taking a SolverWorkspace carves it out of that arena, so the solve does not allocate at all.
+
+// How often the Jacobian is rebuilt, see the top of this file.
+enum class JacobianReuse {
+    Newton,
+    Chord,
+    Shamanskii,
+    Broyden,
+};
+
+// Outcome of a solve of a nonlinear system. The solution, or the last iterate, is left in x.
+struct SystemSolveResult {
+    SolveStatus status = SolveStatus::MaxIterationsReached;
+    int iterations = 0;
+    int evaluations = 0;            // evaluations of F, those spent on Jacobians included
+    int jacobianEvaluations = 0;    // Jacobians built and factored
+    double residualNorm = 0;        // max |F_i(x)| at the returned x
+    double stepNorm = 0;            // max |Δx_i| of the last step
+
+    bool converged() const { return status == SolveStatus::Converged; }
+    explicit operator bool() const { return converged(); }
+};
+
+/**
+ * @brief Preallocated storage of a nonlinear system solve of dimension n.
+ *
+ * Holds the Jacobian and its LU factors, the residual and step vectors, the dual-number buffers of
+ * AutomaticJacobian and the Broyden steps. Pass the same workspace to repeated solves of the same
+ * dimension to allocate only once, or carve it out of a SolverWorkspace shared with the other
+ * engines of the thread.
+ */
+struct NewtonSystemWorkspace {
+    /**
+     * @param dimension The number of unknowns n.
+     * @param maxUpdates The number of Broyden updates kept before the Jacobian is rebuilt.
+     */
+    explicit NewtonSystemWorkspace(std::size_t dimension, std::size_t maxUpdates = 20)
+        : storage(std::make_unique<SolverWorkspace>(required_bytes(dimension, maxUpdates))) {
+        carve(*storage, dimension, maxUpdates);
+    }
+
+    /**
+     * @brief Takes the buffers from `arena`; they are valid until the enclosing SolverWorkspace::Scope closes.
+     */
+    NewtonSystemWorkspace(SolverWorkspace& arena, std::size_t dimension, std::size_t maxUpdates = 20) {
+        carve(arena, dimension, maxUpdates);
+    }
+
+    std::size_t dimension() const { return pivots.size(); }
+    std::size_t max_updates() const { return broydenNorms.size(); }
+
+    // What a workspace of this shape takes from a SolverWorkspace.
+    static std::size_t required_bytes(std::size_t dimension, std::size_t maxUpdates) {
+        auto padded = [](std::size_t bytes) {
+            return (bytes + SolverWorkspace::alignment - 1) / SolverWorkspace::alignment * SolverWorkspace::alignment;
+        };
+        return padded(dimension * dimension * sizeof(double)) + padded(dimension * sizeof(std::size_t))
+               + 4 * padded(dimension * sizeof(double)) + padded(maxUpdates * dimension * sizeof(double))
+               + padded(maxUpdates * sizeof(double)) + 2 * padded(dimension * sizeof(Dual<double>));
+    }
+
+    std::span<double> jacobian;             // n×n row-major, then its LU factors
+    std::span<std::size_t> pivots;
+    std::span<double> residual;             // F(x) at the current iterate
+    std::span<double> step;
+    std::span<double> trial;                // perturbed x of a finite-difference column
+    std::span<double> trialResidual;
+    std::span<double> broydenSteps;         // the steps since the last rebuild, n each
+    std::span<double> broydenNorms;         // their squared norms
+    std::span<Dual<double>> dualX;
+    std::span<Dual<double>> dualResidual;
+
+private:
+    void carve(SolverWorkspace& arena, std::size_t dimension, std::size_t maxUpdates) {
+        jacobian = arena.allocate_array<double>(dimension * dimension);
+        pivots = arena.allocate_array<std::size_t>(dimension);
+        residual = arena.allocate_array<double>(dimension);
+        step = arena.allocate_array<double>(dimension);
+        trial = arena.allocate_array<double>(dimension);
+        trialResidual = arena.allocate_array<double>(dimension);
+        broydenSteps = arena.allocate_array<double>(maxUpdates * dimension);
+        broydenNorms = arena.allocate_array<double>(maxUpdates);
+        dualX = arena.allocate_array<Dual<double>>(dimension);
+        dualResidual = arena.allocate_array<Dual<double>>(dimension);
+    }
+
+    std::unique_ptr<SolverWorkspace> storage;   // the buffers, unless they come from an arena
+};
+
+// True when the residual f can be evaluated on dual numbers.
+template <typename F>
+concept DualResidual = requires(F& f, std::span<const Dual<double>> x, std::span<Dual<double>> fx) {
+    f(x, fx);
+};
+
+// Jacobian policies: `policy(f, x, fx, workspace)` writes the Jacobian of f at x to
+// workspace.jacobian (row-major, ∂F_i/∂x_j at i·n + j), given fx = F(x), and returns the number of
+// evaluations of f it spent.
+
+// One-sided differences reusing F(x), one evaluation per column; the default step
+// sqrt(eps)·max(|x_j|, 1) balances truncation and rounding error.
+struct ForwardDifferenceJacobian {
+    double step = 0;   // 0 chooses the step per column
+
+    template <typename F>
+    int operator()(F&& f, std::span<const double> x, std::span<const double> fx,
+                   NewtonSystemWorkspace& workspace) const {
+        const std::size_t n = x.size();
+        std::copy(x.begin(), x.end(), workspace.trial.begin());
+        for (std::size_t j = 0; j < n; j++) {
+            double h = step > 0 ? step : std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(std::abs(x[j]), 1.0);
+            workspace.trial[j] = x[j] + h;
+            h = workspace.trial[j] - x[j];  // the step actually taken
+            f(std::span<const double>(workspace.trial), std::span<double>(workspace.trialResidual));
+            for (std::size_t i = 0; i < n; i++) {
+                workspace.jacobian[i * n + j] = (workspace.trialResidual[i] - fx[i]) / h;
+            }
+            workspace.trial[j] = x[j];
+        }
+        return static_cast<int>(n);
+    }
+};
+
+// Default policy: the exact Jacobian from n dual-number evaluations, one per column, when f is
+// generic over its element type, otherwise ForwardDifferenceJacobian.
+struct AutomaticJacobian {
+    template <typename F>
+    int operator()(F&& f, std::span<const double> x, std::span<const double> fx,
+                   NewtonSystemWorkspace& workspace) const {
+        if constexpr (DualResidual<F>) {
+            const std::size_t n = x.size();
+            for (std::size_t j = 0; j < n; j++) {
+                workspace.dualX[j] = Dual<double>(x[j]);
+            }
+            for (std::size_t j = 0; j < n; j++) {
+                workspace.dualX[j].derivative = 1;
+                f(std::span<const Dual<double>>(workspace.dualX), std::span<Dual<double>>(workspace.dualResidual));
+                for (std::size_t i = 0; i < n; i++) {
+                    workspace.jacobian[i * n + j] = workspace.dualResidual[i].derivative;
+                }
+                workspace.dualX[j].derivative = 0;
+            }
+            return static_cast<int>(n);
+        } else {
+            return ForwardDifferenceJacobian{}(f, x, fx, workspace);
+        }
+    }
+};
+
+// User-supplied Jacobian, called as `jacobian(x, J)` with J the row-major n×n span to fill.
+template <typename J>
+struct AnalyticJacobian {
+    J jacobian;
+
+    template <typename F>
+    int operator()(F&&, std::span<const double> x, std::span<const double>, NewtonSystemWorkspace& workspace) {
+        jacobian(x, std::span<double>(workspace.jacobian));
+        return 0;
+    }
+};
+
+template <typename J>
+AnalyticJacobian<std::decay_t<J>> analytic_jacobian(J&& jacobian) {
+    return {std::forward<J>(jacobian)};
+}
+
+namespace detail {
+
+inline double max_norm(std::span<const double> v) {
+    double norm = 0;
+    for (double value : v) {
+        norm = std::max(norm, std::abs(value));
+    }
+    return norm;
+}
+
+inline double dot(std::span<const double> u, std::span<const double> v) {
+    double sum = 0;
+    for (std::size_t i = 0; i < u.size(); i++) {
+        sum += u[i] * v[i];
+    }
+    return sum;
+}
+
+} // namespace detail
+
+/**
+ * @brief Solves the nonlinear system F(x) = 0 by Newton's method, without throwing.
+ *
+ * @param x The starting point on entry, the solution (or the last iterate) on return.
+ * @param f The residual, called as `f(x, fx)`.
+ * @param workspace Storage of dimension x.size(), see NewtonSystemWorkspace.
+ * @param tolerance The convergence criterion. The algorithm stops when max |Δx_i| < tolerance.
+ * @param maxIterations The maximum number of iterations allowed.
+ * @param reuse How often the Jacobian is rebuilt (see JacobianReuse).
+ * @param refreshInterval The iterations between rebuilds in `Shamanskii` mode.
+ * @param jacobian The Jacobian policy (AutomaticJacobian, ForwardDifferenceJacobian or analytic_jacobian()).
+ * @param observer Receives the iteration table (see solver-observers.h); defaults to no output.
+ * @return SystemSolveResult with status `Converged`, `ZeroDerivative` if a Jacobian is singular, or
+ *         `MaxIterationsReached`.
+ * @throws std::invalid_argument If the workspace does not have the dimension of x.
+ */
+template <typename F, typename Jacobian = AutomaticJacobian, typename Observer = NullObserver>
+SystemSolveResult try_newton_system_solver(std::span<double> x, F&& f, NewtonSystemWorkspace& workspace,
+                                           double tolerance = 1e-6, int maxIterations = 1000000,
+                                           JacobianReuse reuse = JacobianReuse::Newton, int refreshInterval = 5,
+                                           Jacobian&& jacobian = Jacobian{}, Observer&& observer = Observer{}) {
+    const std::size_t n = x.size();
+    if (workspace.dimension() != n) {
+        throw std::invalid_argument("The workspace must have the dimension of the system.");
+    }
+    std::span<double> residual(workspace.residual);
+    std::span<double> step(workspace.step);
+    std::span<double> matrix(workspace.jacobian);
+    std::span<std::size_t> pivots(workspace.pivots);
+
+    SystemSolveResult result;
+    f(std::span<const double>(x), residual);
+    result.evaluations = 1;
+    result.residualNorm = detail::max_norm(residual);
+
+    detail::start_table(observer, "newton_system", {{"Iteration", 10}, {"max |F(x)|", 15}, {"max |dx|", 15}});
+
+    bool rebuild = true;
+    int sinceRebuild = 0;
+    std::size_t updates = 0;
+    for (int i = 1; i <= maxIterations; i++) {
+        if (detail::stop_requested(observer)) {
+            result.status = SolveStatus::Cancelled;
+            return result;
+        }
+
+        // step = -J⁻¹ F(x), with J rebuilt or corrected as the mode asks
+        while (true) {
+            if (rebuild || reuse == JacobianReuse::Newton
+                || (reuse == JacobianReuse::Shamanskii && sinceRebuild >= refreshInterval)) {
+                result.evaluations += jacobian(f, std::span<const double>(x), std::span<const double>(residual),
+                                               workspace);
+                result.jacobianEvaluations++;
+                if (!lu_factor(matrix, pivots)) {
+                    result.status = SolveStatus::ZeroDerivative;
+                    return result;
+                }
+                rebuild = false;
+                sinceRebuild = 0;
+                updates = 0;
+            }
+            for (std::size_t j = 0; j < n; j++) {
+                step[j] = -residual[j];
+            }
+            lu_solve(matrix, pivots, step);
+
+            if (reuse == JacobianReuse::Broyden && updates > 0) {
+                // z = -B₀⁻¹F + Σ s_(k+1) (s_kᵀ z) / |s_k|², then step = z / (1 - s_lastᵀ z / |s_last|²)
+                for (std::size_t k = 0; k + 1 < updates; k++) {
+                    std::span<const double> sk(&workspace.broydenSteps[k * n], n);
+                    std::span<const double> sNext(&workspace.broydenSteps[(k + 1) * n], n);
+                    double weight = detail::dot(sk, step) / workspace.broydenNorms[k];
+                    for (std::size_t j = 0; j < n; j++) {
+                        step[j] += weight * sNext[j];
+                    }
+                }
+                std::span<const double> sLast(&workspace.broydenSteps[(updates - 1) * n], n);
+                double denominator = 1 - detail::dot(sLast, step) / workspace.broydenNorms[updates - 1];
+                if (!(std::abs(denominator) > 1e-12) || !std::isfinite(denominator)) {
+                    rebuild = true;  // the update breaks down, start over from a fresh Jacobian
+                    continue;
+                }
+                for (std::size_t j = 0; j < n; j++) {
+                    step[j] /= denominator;
+                }
+            }
+            break;
+        }
+
+        for (std::size_t j = 0; j < n; j++) {
+            x[j] += step[j];
+        }
+        sinceRebuild++;
+        f(std::span<const double>(x), residual);
+        result.evaluations++;
+        result.iterations = i;
+        double previousNorm = result.residualNorm;
+        result.residualNorm = detail::max_norm(residual);
+        result.stepNorm = detail::max_norm(step);
+
+        observer.on_iteration(i, {result.residualNorm, result.stepNorm});
+
+        if (result.stepNorm < tolerance || result.residualNorm == 0) {
+            result.status = SolveStatus::Converged;
+            return result;
+        }
+
+        if (reuse == JacobianReuse::Broyden) {
+            if (updates == workspace.max_updates()) {
+                rebuild = true;
+            } else {
+                std::copy(step.begin(), step.end(), workspace.broydenSteps.begin() + updates * n);
+                workspace.broydenNorms[updates] = detail::dot(step, step);
+                updates++;
+            }
+        }
+        if (reuse != JacobianReuse::Newton && !(result.residualNorm < previousNorm)) {
+            rebuild = true;  // the kept Jacobian no longer contracts
+        }
+    }
+    result.status = SolveStatus::MaxIterationsReached;
+    return result;
+}
+
+/**
+ * @brief Solves the nonlinear system F(x) = 0 by Newton's method, without throwing.
+ *
+ * Overload taking its NewtonSystemWorkspace (with the default number of Broyden updates) from
+ * `workspace`, which gets it back on return.
+ */
+template <typename F, typename Jacobian = AutomaticJacobian, typename Observer = NullObserver>
+SystemSolveResult try_newton_system_solver(std::span<double> x, F&& f, SolverWorkspace& workspace,
+                                           double tolerance = 1e-6, int maxIterations = 1000000,
+                                           JacobianReuse reuse = JacobianReuse::Newton, int refreshInterval = 5,
+                                           Jacobian&& jacobian = Jacobian{}, Observer&& observer = Observer{}) {
+    SolverWorkspace::Scope scope(workspace);
+    NewtonSystemWorkspace systemWorkspace(workspace, x.size());
+    return try_newton_system_solver(x, std::forward<F>(f), systemWorkspace, tolerance, maxIterations, reuse,
+                                    refreshInterval, std::forward<Jacobian>(jacobian),
+                                    std::forward<Observer>(observer));
+}
+
+/**
+ * @brief Solves the nonlinear system F(x) = 0 by Newton's method, without throwing.
+ *
+ * Overload allocating its own NewtonSystemWorkspace (once, before the iteration starts).
+ */
+template <typename F, typename Jacobian = AutomaticJacobian, typename Observer = NullObserver>
+SystemSolveResult try_newton_system_solver(std::span<double> x, F&& f, double tolerance = 1e-6,
+                                           int maxIterations = 1000000, JacobianReuse reuse = JacobianReuse::Newton,
+                                           int refreshInterval = 5, Jacobian&& jacobian = Jacobian{},
+                                           Observer&& observer = Observer{}) {
+    NewtonSystemWorkspace workspace(x.size());
+    return try_newton_system_solver(x, std::forward<F>(f), workspace, tolerance, maxIterations, reuse,
+                                    refreshInterval, std::forward<Jacobian>(jacobian),
+                                    std::forward<Observer>(observer));
+}
+
+/**
+ * @brief Solves the nonlinear system F(x) = 0 by Newton's method.
+ *
+ * Throwing form of try_newton_system_solver(); the solution is left in x.
+ *
+ * @throws std::invalid_argument If a Jacobian is singular at an iterate.
+ * @throws std::runtime_error If the method fails to converge within the specified number of iterations.
+ */
+template <typename F, typename Jacobian = AutomaticJacobian, typename Observer = NullObserver>
+void newton_system_solver(std::span<double> x, F&& f, double tolerance = 1e-6, int maxIterations = 1000000,
+                          JacobianReuse reuse = JacobianReuse::Newton, int refreshInterval = 5,
+                          Jacobian&& jacobian = Jacobian{}, Observer&& observer = Observer{}) {
+    SystemSolveResult result = try_newton_system_solver(x, std::forward<F>(f), tolerance, maxIterations, reuse,
+                                                        refreshInterval, std::forward<Jacobian>(jacobian),
+                                                        std::forward<Observer>(observer));
+    if (result.status == SolveStatus::ZeroDerivative) {
+        throw std::invalid_argument("Jacobian is singular at the current guess; the algorithm cannot proceed.");
+    }
+    if (!result.converged()) {
+        throw SolverError(result.status, "No solution found after ", maxIterations, " steps.");
+    }
+}
+
+#endif //NEWTON_SYSTEMS_SOLVER_H
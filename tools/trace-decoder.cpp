@@ -0,0 +1,29 @@
+//
+// Created by Hello on 14.10.2026.
+//
+// Renders a binary iteration trace, as written by write_trace(), as the solvers' iteration tables.
+//
+//     trace-decoder trace.bin
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "../solutions of equations in one variable/iteration-trace.h"
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s trace-file\n", argv[0]);
+        return 2;
+    }
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "could not open %s\n", argv[1]);
+        return 1;
+    }
+    if (!decode_trace(in, std::cout)) {
+        std::fprintf(stderr, "%s is not a complete iteration trace\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}